@@ -6,11 +6,12 @@
 
 #include "sl/core.hpp"
 #include "sl/utils/hash.hpp"
+#include "sl/utils/stringId.hpp"
 #include "sl/utils/uuid.hpp"
 
 
 namespace sl {
-	using EventCategory = sl::utils::Hash64;
+	using EventCategory = sl::utils::StringId;
 	using ListenerUUID = sl::utils::BasicUUID<std::uint64_t, static_cast<std::size_t> (sl::utils::hash<sl::utils::Hash64> (__FILE__, sizeof(__FILE__))) + __LINE__>;
 
 	template <typename T>
@@ -58,7 +59,7 @@ namespace sl {
 	};
 
 	namespace literals {
-		constexpr auto operator ""_ecat(const char *str, std::size_t N) noexcept -> EventCategory {return sl::utils::hash<sl::utils::Hash64> (str, N);}
+		constexpr auto operator ""_ecat(const char *str, std::size_t N) noexcept -> EventCategory {return EventCategory(str, N);}
 	} // namespace literals
 
 } // namespace sl
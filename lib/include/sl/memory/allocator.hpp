@@ -1,6 +1,8 @@
 #pragma once
 
+#include <cstddef>
 #include <memory>
+#include <type_traits>
 
 #include "sl/memory/allocatorTraits.hpp"
 
@@ -9,5 +11,37 @@ namespace sl::memory {
 	template <typename T>
 	using DefaultAllocator = std::allocator<T>;
 
-} // namespace sl::memory
 
+	/*
+	 * Allocator of the containers that keep all their elements inline and must never allocate, like sl::InlineString.
+	 * It only exists to fill their allocator parameter, and any call to `allocate` is a bug of the container
+	 */
+	template <typename T>
+	class NullAllocator final {
+		public:
+			using value_type = T;
+			using pointer = value_type*;
+			using const_pointer = const value_type*;
+			using size_type = std::size_t;
+			using difference_type = std::ptrdiff_t;
+			using is_always_equal = std::true_type;
+
+			constexpr NullAllocator() noexcept = default;
+			template <typename U>
+			constexpr NullAllocator(const NullAllocator<U> &) noexcept {}
+			constexpr ~NullAllocator() = default;
+
+			constexpr NullAllocator(const NullAllocator<T> &) noexcept = default;
+			constexpr auto operator=(const NullAllocator<T> &) noexcept -> NullAllocator<T>& = default;
+
+			[[nodiscard]]
+			constexpr auto allocate(size_type) const noexcept -> pointer {return nullptr;}
+			constexpr auto deallocate(pointer, size_type) const noexcept -> void {}
+
+			constexpr auto operator==(const NullAllocator<T> &) const noexcept -> bool {return true;}
+	};
+
+
+	static_assert(sl::memory::IsAllocator<NullAllocator<char>>);
+
+} // namespace sl::memory
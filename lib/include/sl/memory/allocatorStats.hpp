@@ -0,0 +1,123 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <iosfwd>
+#include <string_view>
+#include <vector>
+
+#include "sl/core.hpp"
+#include "sl/utils/units.hpp"
+
+
+namespace sl::memory {
+	using namespace sl::utils::literals;
+
+	struct AllocatorStats {
+		sl::utils::Bytes usedSize;
+		sl::utils::Bytes peakUsedSize;
+		sl::utils::Bytes capacity;
+		std::size_t allocationCount;
+		std::size_t deallocationCount;
+		std::size_t failedAllocationCount;
+		// 0 when the free memory is contiguous, close to 1 when it's scattered in small ranges
+		float fragmentation;
+	};
+
+	struct AllocatorFrameDelta {
+		std::ptrdiff_t usedSize;
+		std::size_t allocationCount;
+		std::size_t deallocationCount;
+		std::size_t failedAllocationCount;
+	};
+
+	struct AllocatorStatsReport {
+		std::string_view name;
+		AllocatorStats stats;
+		AllocatorFrameDelta frameDelta;
+	};
+
+
+#ifdef SL_MEMORY_STATS
+	/*
+	 * Member of every allocator, that reports its activity to the AllocatorStatsRegistry. `name` must outlive
+	 * the tracker, which is the case of string literals. Only the thread that uses the allocator updates its
+	 * stats, with relaxed atomic stores, so that the registry can read them from any thread
+	 */
+	class SL_CORE AllocatorStatsTracker {
+		friend class AllocatorStatsRegistry;
+
+		public:
+			AllocatorStatsTracker(std::string_view name, sl::utils::Bytes capacity = 0_B) noexcept;
+			~AllocatorStatsTracker();
+
+			AllocatorStatsTracker(const AllocatorStatsTracker &) noexcept = delete;
+			auto operator=(const AllocatorStatsTracker &) noexcept -> AllocatorStatsTracker& = delete;
+			AllocatorStatsTracker(AllocatorStatsTracker &&tracker) noexcept;
+			auto operator=(AllocatorStatsTracker &&tracker) noexcept -> AllocatorStatsTracker&;
+
+			inline auto onAllocation(sl::utils::Bytes size) noexcept -> void {
+				const sl::utils::Bytes usedSize {m_stats.usedSize + size};
+				s_store(m_stats.allocationCount, m_stats.allocationCount + 1);
+				s_store(m_stats.usedSize, usedSize);
+				if (usedSize > m_stats.peakUsedSize)
+					s_store(m_stats.peakUsedSize, usedSize);
+			}
+			inline auto onDeallocation(sl::utils::Bytes size) noexcept -> void {
+				s_store(m_stats.deallocationCount, m_stats.deallocationCount + 1);
+				s_store(m_stats.usedSize, m_stats.usedSize - size);
+			}
+			inline auto onFailedAllocation() noexcept -> void {s_store(m_stats.failedAllocationCount, m_stats.failedAllocationCount + 1);}
+			inline auto setCapacity(sl::utils::Bytes capacity) noexcept -> void {s_store(m_stats.capacity, capacity);}
+			inline auto setFragmentation(float fragmentation) noexcept -> void {s_store(m_stats.fragmentation, fragmentation);}
+
+			auto getStats() const noexcept -> AllocatorStats;
+			auto getFrameDelta() const noexcept -> AllocatorFrameDelta;
+
+		private:
+			// Only the owning thread writes a field, so a plain read followed by a store never loses an update
+			template <typename T>
+			static inline auto s_store(T &field, T value) noexcept -> void {std::atomic_ref<T> (field).store(value, std::memory_order_relaxed);}
+
+			std::string_view m_name;
+			AllocatorStats m_stats;
+			AllocatorStats m_frameStartStats;
+			bool m_isRegistered;
+	};
+
+#else
+	class AllocatorStatsTracker {
+		public:
+			constexpr AllocatorStatsTracker(std::string_view, sl::utils::Bytes = 0_B) noexcept {}
+
+			constexpr auto onAllocation(sl::utils::Bytes) noexcept -> void {}
+			constexpr auto onDeallocation(sl::utils::Bytes) noexcept -> void {}
+			constexpr auto onFailedAllocation() noexcept -> void {}
+			constexpr auto setCapacity(sl::utils::Bytes) noexcept -> void {}
+			constexpr auto setFragmentation(float) noexcept -> void {}
+	};
+#endif
+
+
+	/*
+	 * Gives access to the stats of every live allocator. Without SL_MEMORY_STATS defined, it's always empty
+	 * and the trackers compile to nothing
+	 */
+	class SL_CORE AllocatorStatsRegistry {
+		friend class AllocatorStatsTracker;
+
+		public:
+			static auto getReports() noexcept -> std::vector<AllocatorStatsReport>;
+			// Makes the current stats the reference of the frame deltas of the next frame
+			static auto endFrame() noexcept -> void;
+			static auto dump() noexcept -> void;
+			static auto dump(std::ostream &stream) noexcept -> void;
+
+		private:
+			static auto s_registerTracker(AllocatorStatsTracker &tracker) noexcept -> void;
+			static auto s_unregisterTracker(AllocatorStatsTracker &tracker) noexcept -> void;
+			// Gives the place of `previous` in the registry to `tracker`, along with its frame start stats
+			static auto s_replaceTracker(AllocatorStatsTracker &previous, AllocatorStatsTracker &tracker) noexcept -> void;
+	};
+
+} // namespace sl::memory
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstddef>
+#include <memory_resource>
+#include <vector>
+
+#include "sl/core.hpp"
+#include "sl/memory/stackAllocator.hpp"
+#include "sl/utils/units.hpp"
+
+
+namespace sl::memory {
+	/*
+	 * Memory resource that allocates from a StackAllocator, and gives back everything it allocated from it
+	 * when it goes out of scope. When the stack is full, it falls back to `upstream`, whose blocks are freed
+	 * at the end of the scope at the latest. Scopes can be nested, but only the innermost one may allocate
+	 */
+	class SL_CORE ArenaScope final : public std::pmr::memory_resource {
+		public:
+			ArenaScope(StackAllocator &allocator, std::pmr::memory_resource &upstream = *std::pmr::get_default_resource()) noexcept;
+			~ArenaScope();
+
+			ArenaScope(const ArenaScope &) noexcept = delete;
+			auto operator=(const ArenaScope &) noexcept -> ArenaScope& = delete;
+			ArenaScope(ArenaScope &&) noexcept = delete;
+			auto operator=(ArenaScope &&) noexcept -> ArenaScope& = delete;
+
+			// Allocations that didn't fit in the stack since the start of the scope
+			inline auto getOverflowCount() const noexcept -> std::size_t {return m_overflowCount;}
+			inline auto getOverflowSize() const noexcept -> sl::utils::Bytes {return m_overflowSize;}
+
+		private:
+			struct OverflowBlock {
+				void *ptr;
+				std::size_t size;
+				std::size_t alignment;
+			};
+
+			auto do_allocate(std::size_t bytes, std::size_t alignment) -> void* override;
+			auto do_deallocate(void *ptr, std::size_t bytes, std::size_t alignment) -> void override;
+			inline auto do_is_equal(const std::pmr::memory_resource &other) const noexcept -> bool override {return this == &other;}
+
+			StackAllocator *m_allocator;
+			std::pmr::memory_resource *m_upstream;
+			StackAllocator::Marker m_marker;
+			// the blocks taken from upstream and not deallocated yet
+			std::vector<OverflowBlock> m_overflowBlocks;
+			std::size_t m_overflowCount;
+			sl::utils::Bytes m_overflowSize;
+	};
+
+} // namespace sl::memory
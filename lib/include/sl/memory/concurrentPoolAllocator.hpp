@@ -0,0 +1,110 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+#include "sl/core.hpp"
+#include "sl/memory/allocatorTraits.hpp"
+
+
+namespace sl::memory {
+	constexpr std::size_t MAX_THREAD_SLOT_COUNT {64};
+	constexpr std::size_t NO_THREAD_SLOT {std::numeric_limits<std::size_t>::max()};
+
+	/*
+	 * Returns a small index unique to the calling thread among the running threads, or NO_THREAD_SLOT if
+	 * MAX_THREAD_SLOT_COUNT threads already hold one. The index is given back when the thread exits
+	 */
+	SL_CORE auto getThreadSlot() noexcept -> std::size_t;
+
+
+	/*
+	 * Fixed size pool that can be used from any thread. Each thread allocates from and deallocates to its
+	 * own magazine of free slots, and only touches the shared free stack to exchange whole batches of slots
+	 * with it. Slots cached in the magazine of another thread can't be allocated until they are flushed, so every
+	 * thread must call flushThreadCache() before it exits
+	 */
+	template <typename T>
+	class ConcurrentPoolAllocator {
+		public:
+			using value_type = T;
+			using pointer = T*;
+			using const_pointer = const T*;
+			using reference = T&;
+			using const_reference = const T&;
+			using size_type = std::size_t;
+			using difference_type = std::ptrdiff_t;
+			using is_always_equal = std::false_type;
+
+			ConcurrentPoolAllocator(size_type size) noexcept;
+			~ConcurrentPoolAllocator();
+
+			ConcurrentPoolAllocator(const ConcurrentPoolAllocator<T> &allocator) noexcept;
+			auto operator=(const ConcurrentPoolAllocator<T> &allocator) noexcept -> ConcurrentPoolAllocator<T>&;
+			ConcurrentPoolAllocator(ConcurrentPoolAllocator<T> &&allocator) noexcept;
+			auto operator=(ConcurrentPoolAllocator<T> &&allocator) noexcept -> ConcurrentPoolAllocator<T>&;
+
+			[[nodiscard]]
+			auto allocate(size_type n = 1) noexcept -> pointer;
+			auto deallocate(pointer ptr, size_type n = 1) noexcept -> void;
+			/*
+			 * Gives the free slots cached by the calling thread back to the shared free stack. Required before the
+			 * thread exits, as its magazine is otherwise unreachable until another thread gets the same thread slot
+			 */
+			auto flushThreadCache() noexcept -> void;
+
+			inline auto operator==(const ConcurrentPoolAllocator<T> &allocator) const noexcept {return m_control == allocator.m_control;}
+
+
+		private:
+			using index_type = std::uint32_t;
+
+			static constexpr index_type NO_SLOT {std::numeric_limits<index_type>::max()};
+			static constexpr size_type MAGAZINE_CAPACITY {64};
+			static constexpr size_type BATCH_SIZE {MAGAZINE_CAPACITY / 2};
+
+			/*
+			 * A free slot links to the next slot of its batch, and the first slot of a batch links to the next
+			 * batch of the free stack
+			 */
+			union Slot {
+				alignas(T) std::byte value[sizeof(T)];
+				struct {
+					index_type nextInBatch;
+					index_type nextBatch;
+				} links;
+			};
+
+			struct alignas(64) Magazine {
+				size_type count;
+				index_type indices[MAGAZINE_CAPACITY];
+			};
+
+			struct ControlBlock {
+				std::atomic<size_type> referenceCount;
+				size_type size;
+				Slot *slots;
+				// index of the first batch in the low half, and a tag bumped by every push in the high half against ABA
+				alignas(64) std::atomic<std::uint64_t> freeStackHead;
+				alignas(64) std::atomic<size_type> untouchedIndex;
+				Magazine magazines[MAX_THREAD_SLOT_COUNT];
+			};
+
+			inline auto m_pushBatch(index_type first) noexcept -> void;
+			// Returns the first slot of the popped batch, or NO_SLOT if the free stack is empty
+			inline auto m_popBatch() noexcept -> index_type;
+			inline auto m_refill(Magazine &magazine) noexcept -> void;
+			inline auto m_flush(Magazine &magazine, size_type count) noexcept -> void;
+			// Drops this allocator's reference to the control block, and frees it if it was the last one
+			inline auto m_release() noexcept -> void;
+
+			ControlBlock *m_control;
+	};
+
+	static_assert(sl::memory::IsAllocator<ConcurrentPoolAllocator<char>>);
+
+} // namespace sl::memory
+
+#include "sl/memory/concurrentPoolAllocator.inl"
@@ -0,0 +1,213 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdlib>
+
+#include "sl/memory/concurrentPoolAllocator.hpp"
+#include "sl/utils/assert.hpp"
+
+
+namespace sl::memory {
+	template <typename T>
+	ConcurrentPoolAllocator<T>::ConcurrentPoolAllocator(size_type size) noexcept :
+		m_control {new ControlBlock{}}
+	{
+		SL_TEXT_ASSERT(size < NO_SLOT, "ConcurrentPoolAllocator can't hold that many slots");
+		m_control->referenceCount.store(1, std::memory_order_relaxed);
+		m_control->size = size;
+		m_control->slots = reinterpret_cast<Slot*> (std::malloc(sizeof(Slot) * size));
+		m_control->freeStackHead.store(NO_SLOT, std::memory_order_relaxed);
+		m_control->untouchedIndex.store(0, std::memory_order_relaxed);
+	}
+
+
+	template <typename T>
+	ConcurrentPoolAllocator<T>::~ConcurrentPoolAllocator() {
+		this->m_release();
+	}
+
+
+	template <typename T>
+	ConcurrentPoolAllocator<T>::ConcurrentPoolAllocator(const ConcurrentPoolAllocator<T> &allocator) noexcept :
+		m_control {allocator.m_control}
+	{
+		if (m_control != nullptr)
+			m_control->referenceCount.fetch_add(1, std::memory_order_relaxed);
+	}
+
+
+	template <typename T>
+	auto ConcurrentPoolAllocator<T>::operator=(const ConcurrentPoolAllocator<T> &allocator) noexcept -> ConcurrentPoolAllocator<T>& {
+		if (m_control == allocator.m_control)
+			return *this;
+		this->m_release();
+
+		m_control = allocator.m_control;
+		if (m_control != nullptr)
+			m_control->referenceCount.fetch_add(1, std::memory_order_relaxed);
+
+		return *this;
+	}
+
+
+	template <typename T>
+	ConcurrentPoolAllocator<T>::ConcurrentPoolAllocator(ConcurrentPoolAllocator<T> &&allocator) noexcept :
+		m_control {allocator.m_control}
+	{
+		allocator.m_control = nullptr;
+	}
+
+
+	template <typename T>
+	auto ConcurrentPoolAllocator<T>::operator=(ConcurrentPoolAllocator<T> &&allocator) noexcept -> ConcurrentPoolAllocator<T>& {
+		if (this == &allocator)
+			return *this;
+		this->m_release();
+
+		m_control = allocator.m_control;
+		allocator.m_control = nullptr;
+
+		return *this;
+	}
+
+
+	template <typename T>
+	[[nodiscard]]
+	auto ConcurrentPoolAllocator<T>::allocate(size_type n) noexcept -> pointer {
+		SL_TEXT_ASSERT(n == 1, "n of ConcurrentPoolAllocator->allocate must be 1");
+
+		const size_type threadSlot {sl::memory::getThreadSlot()};
+		if (threadSlot == NO_THREAD_SLOT) {
+			index_type index {this->m_popBatch()};
+			if (index != NO_SLOT) {
+				if (m_control->slots[index].links.nextInBatch != NO_SLOT)
+					this->m_pushBatch(m_control->slots[index].links.nextInBatch);
+				return reinterpret_cast<pointer> (m_control->slots[index].value);
+			}
+
+			const size_type untouchedIndex {m_control->untouchedIndex.fetch_add(1, std::memory_order_relaxed)};
+			if (untouchedIndex >= m_control->size)
+				return nullptr;
+			return reinterpret_cast<pointer> (m_control->slots[untouchedIndex].value);
+		}
+
+		Magazine &magazine {m_control->magazines[threadSlot]};
+		if (magazine.count == 0) {
+			this->m_refill(magazine);
+			if (magazine.count == 0)
+				return nullptr;
+		}
+
+		return reinterpret_cast<pointer> (m_control->slots[magazine.indices[--magazine.count]].value);
+	}
+
+
+	template <typename T>
+	auto ConcurrentPoolAllocator<T>::deallocate(pointer ptr, size_type n) noexcept -> void {
+		SL_TEXT_ASSERT(n == 1, "n of ConcurrentPoolAllocator->deallocate must be 1");
+		if (ptr == nullptr)
+			return;
+
+		const difference_type diff {reinterpret_cast<Slot*> (ptr) - m_control->slots};
+		SL_TEXT_ASSERT(diff >= 0 && static_cast<size_type> (diff) < m_control->size, "Can't deallocate a pointer that doesn't belong to this ConcurrentPoolAllocator");
+		const index_type index {static_cast<index_type> (diff)};
+
+		const size_type threadSlot {sl::memory::getThreadSlot()};
+		if (threadSlot == NO_THREAD_SLOT) {
+			m_control->slots[index].links.nextInBatch = NO_SLOT;
+			this->m_pushBatch(index);
+			return;
+		}
+
+		Magazine &magazine {m_control->magazines[threadSlot]};
+		if (magazine.count == MAGAZINE_CAPACITY)
+			this->m_flush(magazine, BATCH_SIZE);
+		magazine.indices[magazine.count++] = index;
+	}
+
+
+	template <typename T>
+	auto ConcurrentPoolAllocator<T>::flushThreadCache() noexcept -> void {
+		const size_type threadSlot {sl::memory::getThreadSlot()};
+		if (m_control == nullptr || threadSlot == NO_THREAD_SLOT)
+			return;
+
+		Magazine &magazine {m_control->magazines[threadSlot]};
+		if (magazine.count != 0)
+			this->m_flush(magazine, magazine.count);
+	}
+
+
+	template <typename T>
+	auto ConcurrentPoolAllocator<T>::m_pushBatch(index_type first) noexcept -> void {
+		std::atomic_ref<index_type> nextBatch {m_control->slots[first].links.nextBatch};
+		std::uint64_t head {m_control->freeStackHead.load(std::memory_order_relaxed)};
+		std::uint64_t newHead {};
+
+		do {
+			nextBatch.store(static_cast<index_type> (head), std::memory_order_relaxed);
+			newHead = (((head >> 32) + 1) << 32) | first;
+		} while (!m_control->freeStackHead.compare_exchange_weak(head, newHead, std::memory_order_release, std::memory_order_relaxed));
+	}
+
+
+	template <typename T>
+	auto ConcurrentPoolAllocator<T>::m_popBatch() noexcept -> index_type {
+		std::uint64_t head {m_control->freeStackHead.load(std::memory_order_acquire)};
+
+		while (true) {
+			const index_type first {static_cast<index_type> (head)};
+			if (first == NO_SLOT)
+				return NO_SLOT;
+
+			// the batch may be popped and reused concurrently, in which case the tag makes the exchange fail
+			const index_type next {std::atomic_ref<index_type> (m_control->slots[first].links.nextBatch).load(std::memory_order_relaxed)};
+			const std::uint64_t newHead {(head & ~static_cast<std::uint64_t> (NO_SLOT)) | next};
+			if (m_control->freeStackHead.compare_exchange_weak(head, newHead, std::memory_order_acquire, std::memory_order_acquire))
+				return first;
+		}
+	}
+
+
+	template <typename T>
+	auto ConcurrentPoolAllocator<T>::m_refill(Magazine &magazine) noexcept -> void {
+		index_type index {this->m_popBatch()};
+		if (index != NO_SLOT) {
+			for (; index != NO_SLOT; index = m_control->slots[index].links.nextInBatch)
+				magazine.indices[magazine.count++] = index;
+			return;
+		}
+
+		const size_type first {m_control->untouchedIndex.fetch_add(BATCH_SIZE, std::memory_order_relaxed)};
+		const size_type last {std::min(first + BATCH_SIZE, m_control->size)};
+		for (size_type i {last}; i > first; --i)
+			magazine.indices[magazine.count++] = static_cast<index_type> (i - 1);
+	}
+
+
+	template <typename T>
+	auto ConcurrentPoolAllocator<T>::m_flush(Magazine &magazine, size_type count) noexcept -> void {
+		index_type first {NO_SLOT};
+		for (size_type i {0}; i < count; ++i) {
+			const index_type index {magazine.indices[--magazine.count]};
+			m_control->slots[index].links.nextInBatch = first;
+			first = index;
+		}
+
+		this->m_pushBatch(first);
+	}
+
+
+	template <typename T>
+	auto ConcurrentPoolAllocator<T>::m_release() noexcept -> void {
+		if (m_control == nullptr)
+			return;
+
+		if (m_control->referenceCount.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+			std::free(m_control->slots);
+			delete m_control;
+		}
+		m_control = nullptr;
+	}
+
+} // namespace sl::memory
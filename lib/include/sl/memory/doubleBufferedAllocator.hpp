@@ -16,6 +16,9 @@ namespace sl::memory {
 			inline DoubleBufferedAllocator(sl::utils::Bytes size = 16_MiB) noexcept :
 				m_currentStack {0},
 				m_stackAllocators {sl::memory::StackAllocator(size), sl::memory::StackAllocator(size)} {}
+			inline DoubleBufferedAllocator(const sl::memory::StackAllocatorCreateInfos &createInfos) noexcept :
+				m_currentStack {0},
+				m_stackAllocators {sl::memory::StackAllocator(createInfos), sl::memory::StackAllocator(createInfos)} {}
 			inline ~DoubleBufferedAllocator() = default;
 
 			inline DoubleBufferedAllocator(const DoubleBufferedAllocator &) noexcept = delete;
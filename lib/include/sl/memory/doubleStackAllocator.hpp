@@ -1,6 +1,7 @@
 #pragma once
 
 #include "sl/core.hpp"
+#include "sl/memory/allocatorStats.hpp"
 #include "sl/memory/allocatorTraits.hpp"
 #include "sl/utils/units.hpp"
 
@@ -10,6 +11,11 @@ namespace sl::memory {
 
 	class DoubleStackAllocator;
 
+	enum class DoubleStackSide {
+		eBottom,
+		eTop
+	};
+
 
 	class SL_CORE DoubleStackAllocatorMarker {
 		friend class DoubleStackAllocator;
@@ -52,22 +58,40 @@ namespace sl::memory {
 			DoubleStackAllocator(DoubleStackAllocator &&allocator) noexcept;
 			auto operator=(DoubleStackAllocator &&allocator) noexcept -> DoubleStackAllocator&;
 
+			// Allocates from the active stack
+			[[nodiscard]]
+			inline auto allocate(size_type size, size_type alignment) noexcept -> pointer {
+				return this->allocate(size, alignment, m_isTopStackActive ? DoubleStackSide::eTop : DoubleStackSide::eBottom);
+			}
+			// Returns nullptr if the two stacks would collide
 			[[nodiscard]]
-			auto allocate(size_type size, size_type alignment) noexcept -> pointer;
+			auto allocate(size_type size, size_type alignment, DoubleStackSide side) noexcept -> pointer;
 
 			[[nodiscard]]
-			auto mark() const noexcept -> Marker;
+			inline auto mark() const noexcept -> Marker {
+				return this->mark(m_isTopStackActive ? DoubleStackSide::eTop : DoubleStackSide::eBottom);
+			}
+			[[nodiscard]]
+			auto mark(DoubleStackSide side) const noexcept -> Marker;
 			auto deallocate(Marker marker) noexcept -> void;
 
 			auto swapActiveStack() noexcept -> void;
 
+			// Size left between the two stacks
+			inline auto getFreeSize() const noexcept -> sl::utils::Bytes {return static_cast<size_type> (m_topStackTop - m_bottomStackTop);}
+
 
 		private:
+			// Frees both stacks, leaving an allocator of size 0
+			auto m_release() noexcept -> void;
+
 			sl::utils::Bytes m_stackSize;
 			pointer m_stackBase;
 			pointer m_topStackTop;
 			pointer m_bottomStackTop;
 			bool m_isTopStackActive;
+			[[no_unique_address]]
+			sl::memory::AllocatorStatsTracker m_stats;
 	};
 
 
@@ -0,0 +1,132 @@
+#pragma once
+
+#include <cstdint>
+#include <memory_resource>
+#include <new>
+#include <vector>
+
+#include "sl/core.hpp"
+#include "sl/memory/stackAllocator.hpp"
+#include "sl/utils/units.hpp"
+
+
+namespace sl::memory {
+	struct FrameAllocatorCreateInfos {
+		std::size_t frameCount {3};
+		sl::memory::StackAllocatorCreateInfos arena {};
+	};
+
+
+	/*
+	 * Ring of linear arenas, one per frame in flight. A frame ends with a completion token (a fence value, a
+	 * frame index, ...) and its arena is only cleared once signalCompletion() reached that token, so memory
+	 * still read by the GPU is never handed out again
+	 */
+	class SL_CORE FrameAllocator {
+		public:
+			using value_type = sl::memory::StackAllocator::value_type;
+			using pointer = sl::memory::StackAllocator::pointer;
+			using const_pointer = sl::memory::StackAllocator::const_pointer;
+			using size_type = sl::memory::StackAllocator::size_type;
+			using difference_type = sl::memory::StackAllocator::difference_type;
+			using CompletionToken = std::uint64_t;
+
+			FrameAllocator(const FrameAllocatorCreateInfos &createInfos = {}) noexcept;
+			~FrameAllocator() = default;
+
+			FrameAllocator(const FrameAllocator &) noexcept = delete;
+			auto operator=(const FrameAllocator &) noexcept -> FrameAllocator& = delete;
+
+			FrameAllocator(FrameAllocator &&) noexcept = default;
+			auto operator=(FrameAllocator &&) noexcept -> FrameAllocator& = default;
+
+			// Returns nullptr if the arena of the current frame is still in flight
+			[[nodiscard]]
+			auto allocate(size_type size, size_type alignment) noexcept -> pointer;
+
+			// Hands the current frame over until `retireToken` is signaled, and moves to the next arena of the ring
+			auto endFrame(CompletionToken retireToken) noexcept -> void;
+			// Retires every frame whose token is lower or equal to `completedToken`
+			auto signalCompletion(CompletionToken completedToken) noexcept -> void;
+
+			inline auto isCurrentFrameAvailable() const noexcept -> bool {return !m_frames[m_currentFrame].isInFlight;}
+			inline auto getFrameCount() const noexcept -> size_type {return m_frames.size();}
+			inline auto getCurrentFrameUsage() const noexcept -> sl::utils::Bytes {return m_frames[m_currentFrame].arena.getUsedSize();}
+			inline auto getLastFramePeakUsage() const noexcept -> sl::utils::Bytes {return m_lastFramePeakUsage;}
+			// Peak usage of a single frame since the creation of the allocator
+			inline auto getPeakUsage() const noexcept -> sl::utils::Bytes {return m_peakUsage;}
+
+		private:
+			struct Frame {
+				sl::memory::StackAllocator arena;
+				CompletionToken retireToken;
+				bool isInFlight;
+				sl::utils::Bytes peakUsage;
+			};
+
+			std::vector<Frame> m_frames;
+			size_type m_currentFrame;
+			sl::utils::Bytes m_lastFramePeakUsage;
+			sl::utils::Bytes m_peakUsage;
+	};
+
+
+	template <typename T>
+	class FrameAllocatorView {
+		public:
+			using value_type = T;
+			using pointer = value_type*;
+			using const_pointer = const value_type*;
+			using reference = value_type&;
+			using const_reference = const value_type&;
+			using size_type = FrameAllocator::size_type;
+			using difference_type = FrameAllocator::difference_type;
+			using is_always_equal = std::false_type;
+
+			inline FrameAllocatorView(FrameAllocator &allocator) noexcept : m_allocator {&allocator} {}
+			inline ~FrameAllocatorView() = default;
+
+			inline FrameAllocatorView(const FrameAllocatorView<T> &) noexcept = default;
+			inline auto operator=(const FrameAllocatorView<T> &) noexcept -> FrameAllocatorView& = default;
+			inline FrameAllocatorView(FrameAllocatorView<T> &&) noexcept = default;
+			inline auto operator=(FrameAllocatorView<T> &&) noexcept -> FrameAllocatorView& = default;
+
+			[[nodiscard]]
+			inline auto allocate(size_type n) noexcept -> pointer {return reinterpret_cast<pointer> (m_allocator->allocate(sizeof(T) * n, alignof(T)));}
+			inline auto deallocate(pointer, size_type) noexcept -> void {}
+
+			inline auto operator==(const FrameAllocatorView<T> &view) const noexcept -> bool {return m_allocator == view.m_allocator;}
+
+		private:
+			FrameAllocator *m_allocator;
+	};
+
+	static_assert(sl::memory::IsAllocator<FrameAllocatorView<char>>);
+
+	class FrameMemoryResource final : public std::pmr::memory_resource {
+		public:
+			inline FrameMemoryResource(FrameAllocator &allocator) noexcept : m_allocator {&allocator} {}
+			inline FrameMemoryResource(const FrameMemoryResource &) noexcept = default;
+			inline auto operator=(const FrameMemoryResource &) noexcept -> FrameMemoryResource& = default;
+			inline FrameMemoryResource(FrameMemoryResource &&) noexcept = default;
+			inline auto operator=(FrameMemoryResource &&) noexcept -> FrameMemoryResource& = default;
+
+		private:
+			inline auto do_allocate(std::size_t bytes, std::size_t alignment) -> void* override {
+				void *ptr {m_allocator->allocate(bytes, alignment)};
+				if (ptr == nullptr)
+					throw std::bad_alloc();
+				return ptr;
+			}
+			inline auto do_deallocate(void*, std::size_t, std::size_t) -> void override {}
+			inline auto do_is_equal(const std::pmr::memory_resource &other) const noexcept -> bool override {
+				const FrameMemoryResource *resource {dynamic_cast<const FrameMemoryResource*> (&other)};
+				if (resource == nullptr)
+					return false;
+				return m_allocator == resource->m_allocator;
+			}
+
+			FrameAllocator *m_allocator;
+	};
+
+} // namespace sl::memory
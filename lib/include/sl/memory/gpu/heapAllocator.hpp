@@ -7,6 +7,7 @@
 
 #include "sl/core.hpp"
 #include "sl/result.hpp"
+#include "sl/memory/allocatorStats.hpp"
 #include "sl/memory/gpu/allocator.hpp"
 #include "sl/utils/units.hpp"
 
@@ -51,6 +52,8 @@ namespace sl::memory::gpu {
 			sl::utils::Bytes m_size;
 			std::vector<Allocation> m_allocations;
 			VkDeviceMemory m_memory;
+			[[no_unique_address]]
+			sl::memory::AllocatorStatsTracker m_stats {"gpu::HeapAllocator"};
 	};
 
 
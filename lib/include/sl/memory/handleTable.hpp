@@ -0,0 +1,131 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <span>
+#include <vector>
+
+#include "sl/memory/poolAllocator.hpp"
+
+
+namespace sl::memory {
+	template <typename T>
+	class HandleTable;
+
+	/*
+	 * Compact reference to an object of a HandleTable. The generation of a handle must match the one of its
+	 * slot, so a handle whose object was destroyed never aliases the object created in the same slot later
+	 */
+	template <typename T>
+	class Handle final {
+		friend class HandleTable<T>;
+
+		public:
+			using index_type = std::uint32_t;
+			using generation_type = std::uint32_t;
+
+			static constexpr index_type NO_INDEX {std::numeric_limits<index_type>::max()};
+
+			constexpr Handle() noexcept = default;
+			constexpr ~Handle() = default;
+
+			constexpr Handle(const Handle<T> &) noexcept = default;
+			constexpr auto operator=(const Handle<T> &) noexcept -> Handle<T>& = default;
+			constexpr Handle(Handle<T> &&) noexcept = default;
+			constexpr auto operator=(Handle<T> &&) noexcept -> Handle<T>& = default;
+
+			constexpr auto operator==(const Handle<T> &handle) const noexcept -> bool = default;
+
+			// Only tells if the handle was ever given out, use HandleTable::isValid to know if its object is alive
+			constexpr auto isNull() const noexcept -> bool {return m_index == NO_INDEX;}
+			constexpr auto getIndex() const noexcept -> index_type {return m_index;}
+			constexpr auto getGeneration() const noexcept -> generation_type {return m_generation;}
+
+
+		protected:
+			constexpr Handle(index_type index, generation_type generation) noexcept : m_index {index}, m_generation {generation} {}
+
+		private:
+			index_type m_index {NO_INDEX};
+			generation_type m_generation {0};
+	};
+
+	static_assert(sizeof(Handle<int>) == sizeof(std::uint64_t));
+
+
+	/*
+	 * Owns objects referenced by generational handles. The objects live in a PoolAllocator, so they never
+	 * move and iterating over them skips the empty parts of the pool. Looking up a handle is an index and a
+	 * generation check. A slot whose generation wraps around is retired instead of being reused
+	 */
+	template <typename T>
+	class HandleTable final {
+		public:
+			using value_type = T;
+			using size_type = std::size_t;
+			using iterator = sl::memory::PoolAllocatorIterator<T>;
+
+			HandleTable(size_type chunkSize = 256, size_type maxChunkCount = PoolAllocator<T>::UNLIMITED_CHUNK_COUNT) noexcept;
+			~HandleTable();
+
+			HandleTable(const HandleTable<T> &) noexcept = delete;
+			auto operator=(const HandleTable<T> &) noexcept -> HandleTable<T>& = delete;
+			HandleTable(HandleTable<T> &&table) noexcept;
+			auto operator=(HandleTable<T> &&table) noexcept -> HandleTable<T>&;
+
+			// Returns a null handle if the table is full
+			template <typename ...Args>
+			[[nodiscard]]
+			auto create(Args &&...args) noexcept -> Handle<T>;
+			// Returns false if the handle is stale
+			auto destroy(Handle<T> handle) noexcept -> bool;
+			// Returns how many of the handles were valid
+			auto destroy(std::span<const Handle<T>> handles) noexcept -> size_type;
+			auto clear() noexcept -> void;
+
+			inline auto isValid(Handle<T> handle) const noexcept -> bool {
+				return handle.m_index < m_slots.size() && m_slots[handle.m_index].generation == handle.m_generation
+					&& m_slots[handle.m_index].value != nullptr;
+			}
+			// Returns nullptr if the handle is stale
+			inline auto get(Handle<T> handle) const noexcept -> T* {
+				return this->isValid(handle) ? m_slots[handle.m_index].value : nullptr;
+			}
+			inline auto getSize() const noexcept -> size_type {return m_size;}
+
+			inline auto begin() noexcept -> iterator {return m_pool.begin();}
+			inline auto end() noexcept -> iterator {return m_pool.end();}
+
+
+		private:
+			static constexpr typename Handle<T>::index_type NO_FREE_SLOT {Handle<T>::NO_INDEX};
+
+			/*
+			 * `value` is nullptr while the slot is free, in which case `nextFree` links it to the next free
+			 * slot. The generation is bumped every time the object of the slot is destroyed
+			 */
+			struct Slot {
+				T *value;
+				typename Handle<T>::generation_type generation;
+				typename Handle<T>::index_type nextFree;
+			};
+
+			sl::memory::PoolAllocator<T> m_pool;
+			std::vector<Slot> m_slots;
+			typename Handle<T>::index_type m_freeListHead;
+			size_type m_size;
+	};
+
+} // namespace sl::memory
+
+
+template <typename T>
+struct std::hash<sl::memory::Handle<T>> {
+	inline auto operator()(const sl::memory::Handle<T> &handle) const noexcept -> std::size_t {
+		return std::hash<std::uint64_t> {} ((static_cast<std::uint64_t> (handle.getGeneration()) << 32) | handle.getIndex());
+	}
+};
+
+#include "sl/memory/handleTable.inl"
@@ -0,0 +1,122 @@
+#pragma once
+
+#include <memory>
+
+#include "sl/memory/handleTable.hpp"
+#include "sl/utils/assert.hpp"
+
+
+namespace sl::memory {
+	template <typename T>
+	HandleTable<T>::HandleTable(size_type chunkSize, size_type maxChunkCount) noexcept :
+		m_pool {chunkSize, maxChunkCount},
+		m_slots {},
+		m_freeListHead {NO_FREE_SLOT},
+		m_size {0}
+	{
+
+	}
+
+
+	template <typename T>
+	HandleTable<T>::~HandleTable() {
+		this->clear();
+	}
+
+
+	template <typename T>
+	HandleTable<T>::HandleTable(HandleTable<T> &&table) noexcept :
+		m_pool {std::move(table.m_pool)},
+		m_slots {std::move(table.m_slots)},
+		m_freeListHead {table.m_freeListHead},
+		m_size {table.m_size}
+	{
+		table.m_slots.clear();
+		table.m_freeListHead = NO_FREE_SLOT;
+		table.m_size = 0;
+	}
+
+
+	template <typename T>
+	auto HandleTable<T>::operator=(HandleTable<T> &&table) noexcept -> HandleTable<T>& {
+		if (this == &table)
+			return *this;
+		this->clear();
+
+		m_pool = std::move(table.m_pool);
+		m_slots = std::move(table.m_slots);
+		m_freeListHead = table.m_freeListHead;
+		m_size = table.m_size;
+
+		table.m_slots.clear();
+		table.m_freeListHead = NO_FREE_SLOT;
+		table.m_size = 0;
+
+		return *this;
+	}
+
+
+	template <typename T>
+	template <typename ...Args>
+	[[nodiscard]]
+	auto HandleTable<T>::create(Args &&...args) noexcept -> Handle<T> {
+		if (m_freeListHead == NO_FREE_SLOT && m_slots.size() >= Handle<T>::NO_INDEX)
+			return Handle<T> {};
+
+		T *value {m_pool.allocate()};
+		if (value == nullptr)
+			return Handle<T> {};
+		std::construct_at(value, std::forward<Args> (args)...);
+
+		typename Handle<T>::index_type index {m_freeListHead};
+		if (index != NO_FREE_SLOT)
+			m_freeListHead = m_slots[index].nextFree;
+		else {
+			index = static_cast<typename Handle<T>::index_type> (m_slots.size());
+			m_slots.push_back(Slot{nullptr, 0, NO_FREE_SLOT});
+		}
+
+		Slot &slot {m_slots[index]};
+		slot.value = value;
+		++m_size;
+		return Handle<T> (index, slot.generation);
+	}
+
+
+	template <typename T>
+	auto HandleTable<T>::destroy(Handle<T> handle) noexcept -> bool {
+		if (!this->isValid(handle))
+			return false;
+
+		Slot &slot {m_slots[handle.m_index]};
+		std::destroy_at(slot.value);
+		m_pool.deallocate(slot.value);
+		slot.value = nullptr;
+		--m_size;
+
+		if (++slot.generation == 0)
+			return true;
+		slot.nextFree = m_freeListHead;
+		m_freeListHead = handle.m_index;
+		return true;
+	}
+
+
+	template <typename T>
+	auto HandleTable<T>::destroy(std::span<const Handle<T>> handles) noexcept -> size_type {
+		size_type destroyedCount {0};
+		for (const Handle<T> &handle : handles)
+			destroyedCount += this->destroy(handle) ? 1 : 0;
+		return destroyedCount;
+	}
+
+
+	template <typename T>
+	auto HandleTable<T>::clear() noexcept -> void {
+		for (typename Handle<T>::index_type index {0}; index < m_slots.size(); ++index) {
+			if (m_slots[index].value != nullptr)
+				(void)this->destroy(Handle<T> (index, m_slots[index].generation));
+		}
+	}
+
+} // namespace sl::memory
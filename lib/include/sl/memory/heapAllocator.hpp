@@ -1,11 +1,15 @@
 #pragma once
 
 #include <cstdint>
-#include <optional>
+#include <limits>
+#include <new>
 #include <vector>
 
 #include "sl/core.hpp"
+#include "sl/memory/allocatorStats.hpp"
+#include "sl/memory/pageProvider.hpp"
 #include "sl/memory/poolAllocator.hpp"
+#include "sl/utils/assert.hpp"
 #include "sl/utils/units.hpp"
 
 
@@ -66,6 +70,9 @@ namespace sl::memory {
 			requires (!std::same_as<U, T> && !std::same_as<U, const T>)
 			explicit constexpr operator rebind<U> () const noexcept {return rebind<U> (m_pTableEntry, m_offset);}
 
+			// Identifies the allocation independently of where it currently lives, as defragmentation moves it
+			constexpr auto getHandle() const noexcept -> const void* {return m_pTableEntry;}
+
 
 		private:
 			std::byte **m_pTableEntry;
@@ -80,6 +87,37 @@ namespace sl::memory {
 	static_assert(std::contiguous_iterator<HeapAllocatorPointer<char>>);
 
 
+	struct HeapDefragmentationBudget {
+		sl::utils::Millisecond time {std::numeric_limits<float>::infinity()};
+		sl::utils::Bytes size {std::numeric_limits<std::size_t>::max()};
+		std::size_t maxRelocationCount {std::numeric_limits<std::size_t>::max()};
+		// fills HeapDefragmentationReport::fragmentation, at the cost of a walk over every page
+		bool measureFragmentation {false};
+	};
+
+	struct HeapPageFragmentation {
+		sl::utils::Bytes freeSize;
+		sl::utils::Bytes largestFreeRange;
+		float freeRatio;
+	};
+
+	struct HeapFragmentation {
+		sl::utils::Bytes freeSize;
+		sl::utils::Bytes largestFreeRange;
+		float freeRatio;
+		std::vector<HeapPageFragmentation> pages;
+	};
+
+	struct HeapDefragmentationReport {
+		std::size_t relocationCount;
+		sl::utils::Bytes relocatedSize;
+		std::size_t releasedPageCount;
+		// true if the defragmentation went through every page before running out of budget
+		bool isPassComplete;
+		HeapFragmentation fragmentation;
+	};
+
+
 	class SL_CORE HeapAllocator final {
 		friend class HeapMemoryResource;
 
@@ -93,7 +131,8 @@ namespace sl::memory {
 			HeapAllocator(
 				sl::utils::Bytes pageSize = 32_MiB,
 				size_type maxPageCount = 16,
-				sl::utils::Bytes averageAllocationSize = 4 * sizeof(std::uintmax_t)
+				sl::utils::Bytes averageAllocationSize = 4 * sizeof(std::uintmax_t),
+				const sl::memory::PageProviderCreateInfos &pageProvider = {}
 			) noexcept;
 			~HeapAllocator();
 
@@ -106,35 +145,118 @@ namespace sl::memory {
 			auto allocate(size_type size, size_type alignment = 1) noexcept -> pointer;
 			auto deallocate(const pointer &ptr) noexcept -> void;
 
-			auto defragment(size_type maxRelocationCount = 16) noexcept -> void;
+			/*
+			 * Slides allocations down to close the free ranges between them, until the budget runs out. The
+			 * defragmentation resumes where the previous call stopped, and releases the pages that are empty
+			 */
+			auto defragment(const HeapDefragmentationBudget &budget) noexcept -> HeapDefragmentationReport;
+			inline auto defragment(size_type maxRelocationCount = 16) noexcept -> void {
+				(void)this->defragment(HeapDefragmentationBudget{.maxRelocationCount = maxRelocationCount});
+			}
+
+			auto getFragmentation() const noexcept -> HeapFragmentation;
 
 		protected:
 			auto findInPTable(std::byte *ptr) noexcept -> pointer;
 
 		private:
+			struct Page;
+
+			/*
+			 * An allocation is the entry of the pointer table that a HeapAllocatorPointer refers to.
+			 * `start` must stay the first member, as the handles only see it as a `value_type**`.
+			 * Allocations of a page are chained in address order, which makes the deallocation O(1).
+			 * Each allocation owns the free range that follows it, which is indexed by the page's
+			 * two-level segregated fit lists while `freeSize` is not 0
+			 */
 			struct Allocation {
-				value_type **start;
+				value_type *start;
 				size_type size;
 				size_type alignment;
+				size_type freeSize;
+				Page *page;
+				Allocation *previous;
+				Allocation *next;
+				Allocation *previousFree;
+				Allocation *nextFree;
+			};
+
+			// the pTable grows by chunks of at most this many entries instead of being sized for every page up front
+			static constexpr size_type MAX_PTABLE_CHUNK_SIZE {4096};
+			static constexpr size_type SECOND_LEVEL_INDEX_LOG2 {4};
+			static constexpr size_type SECOND_LEVEL_COUNT {1 << SECOND_LEVEL_INDEX_LOG2};
+			static constexpr size_type FIRST_LEVEL_COUNT {std::numeric_limits<size_type>::digits - SECOND_LEVEL_INDEX_LOG2 + 1};
+			// average number of allocations starting in a bucket of the address index, when they have the average size
+			static constexpr size_type ADDRESS_INDEX_BUCKET_ALLOCATION_COUNT {8};
+
+			/*
+			 * `head` is a zero-sized allocation placed at the start of the page, so that the free range at the
+			 * start of the page has an owner too. `addressIndex` splits the page in buckets, and points to the
+			 * first allocation of the chain that starts in each of them, so that a raw pointer is found without
+			 * walking the whole page. It's stored right after the page in the same memory
+			 */
+			struct Page {
+				value_type *memory;
+				Page *previousPage;
+				Page *nextPage;
+				size_type freeSize;
+				Allocation **addressIndex;
+				Allocation head;
+				std::uint64_t firstLevelBitmap;
+				std::uint32_t secondLevelBitmaps[FIRST_LEVEL_COUNT];
+				Allocation *freeLists[FIRST_LEVEL_COUNT][SECOND_LEVEL_COUNT];
 			};
 
 			static auto s_alignToAlignment(value_type *ptr, size_type alignment) noexcept -> value_type*;
+			static auto s_getAllocation(const pointer &ptr) noexcept -> Allocation*;
+			static auto s_initPage(Page &page, value_type *memory, size_type pageSize, Allocation **addressIndex) noexcept -> void;
+
+			static auto s_mapFreeSize(size_type size) noexcept -> std::pair<size_type, size_type>;
+			static auto s_insertFreeRange(Allocation &allocation) noexcept -> void;
+			static auto s_removeFreeRange(Allocation &allocation) noexcept -> void;
+			// Returns the owner of a free range of at least `size` bytes, or nullptr if the page has none
+			static auto s_findFreeRange(const Page &page, size_type size) noexcept -> Allocation*;
+			static auto s_getLargestFreeRange(const Page &page) noexcept -> size_type;
+
+			static auto s_linkAllocation(Allocation &previous, Allocation &allocation) noexcept -> void;
+			static auto s_unlinkAllocation(Allocation &allocation) noexcept -> void;
+			static auto s_relocate(Allocation &allocation) noexcept -> size_type;
+
+			inline auto m_getAddressIndexBucket(const Page &page, const value_type *address) const noexcept -> size_type {
+				return static_cast<size_type> (address - page.memory) >> m_addressIndexBucketSizeLog2;
+			}
+			// The address index of a page is placed right after its `m_pageSize` bytes
+			inline auto m_getAddressIndexOffset() const noexcept -> size_type {
+				return (static_cast<size_type> (m_pageSize) + alignof(Allocation*) - 1) / alignof(Allocation*) * alignof(Allocation*);
+			}
+			// the extra bucket holds the zero-sized allocations placed at the very end of the page
+			inline auto m_getPageMemorySize() const noexcept -> sl::utils::Bytes {
+				return this->m_getAddressIndexOffset() + ((static_cast<size_type> (m_pageSize) >> m_addressIndexBucketSizeLog2) + 1) * sizeof(Allocation*);
+			}
+			// Must be called once `allocation` is linked in its page
+			auto m_insertInAddressIndex(Allocation &allocation) noexcept -> void;
+			// Must be called while `allocation` is still linked in its page
+			auto m_removeFromAddressIndex(Allocation &allocation) noexcept -> void;
 
-			static auto s_findEmptySpot(
-				value_type *page,
-				size_type pageSize,
-				std::vector<Allocation> &allocations,
-				size_type size,
-				size_type alignment
-			) noexcept -> std::optional<std::pair<decltype(allocations.begin()), value_type*>>;
+			auto m_createPage() noexcept -> Page*;
+			auto m_releasePage(Page &page) noexcept -> void;
+			// Frees every page and allocation, leaving the allocator without any page
+			auto m_release() noexcept -> void;
 
 			sl::utils::Bytes m_pageSize;
 			size_type m_pageCount;
 			size_type m_maxPageCount;
 			sl::utils::Bytes m_maxAllocationPageSize;
-			sl::memory::PoolAllocator<value_type*> m_pages;
-			sl::memory::PoolAllocator<value_type*> m_pTable;
-			sl::memory::PoolAllocator<std::vector<Allocation>> m_allocationPages;
+			size_type m_addressIndexBucketSizeLog2;
+			sl::memory::PageProvider m_pageProvider;
+			sl::memory::PoolAllocator<Page> m_pages;
+			sl::memory::PoolAllocator<Allocation> m_pTable;
+			Page *m_firstPage;
+			Page *m_lastPage;
+			// the allocation after which the next defragmentation resumes
+			Allocation *m_defragmentationCursor;
+			[[no_unique_address]]
+			sl::memory::AllocatorStatsTracker m_stats;
 	};
 
 
@@ -178,9 +300,15 @@ namespace sl::memory {
 			inline auto operator=(HeapMemoryResource &&) noexcept -> HeapMemoryResource& = default;
 
 		private:
-			inline auto do_allocate(std::size_t bytes, std::size_t alignment) -> void* override {return &*m_heapAllocator->allocate(bytes, alignment);}
+			inline auto do_allocate(std::size_t bytes, std::size_t alignment) -> void* override {
+				HeapAllocator::pointer handle {m_heapAllocator->allocate(bytes, alignment)};
+				if (handle == nullptr)
+					throw std::bad_alloc();
+				return &*handle;
+			}
 			inline auto do_deallocate(void *ptr, std::size_t, std::size_t) -> void override {
 				HeapAllocator::pointer handle {m_heapAllocator->findInPTable(reinterpret_cast<std::byte*> (ptr))};
+				SL_TEXT_ASSERT(handle != nullptr, "Can't deallocate a pointer that doesn't belong to this HeapAllocator");
 				if (handle == nullptr)
 					return;
 				m_heapAllocator->deallocate(handle);
@@ -0,0 +1,129 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <memory_resource>
+#include <new>
+
+#include "sl/core.hpp"
+#include "sl/memory/doubleStackAllocator.hpp"
+#include "sl/utils/units.hpp"
+
+
+namespace sl::memory {
+	struct LevelArenaCollision {
+		DoubleStackSide side;
+		sl::utils::Bytes requestedSize;
+		sl::utils::Bytes freeSize;
+	};
+
+	class LevelArena;
+
+
+	// Memory resource allocating from one side of a LevelArena. Deallocation is done through the arena's markers
+	class LevelArenaMemoryResource final : public std::pmr::memory_resource {
+		friend class LevelArena;
+
+		public:
+			inline LevelArenaMemoryResource(const LevelArenaMemoryResource &) noexcept = default;
+			inline auto operator=(const LevelArenaMemoryResource &) noexcept -> LevelArenaMemoryResource& = default;
+			inline LevelArenaMemoryResource(LevelArenaMemoryResource &&) noexcept = default;
+			inline auto operator=(LevelArenaMemoryResource &&) noexcept -> LevelArenaMemoryResource& = default;
+
+		protected:
+			inline LevelArenaMemoryResource(LevelArena &arena, DoubleStackSide side) noexcept : m_arena {&arena}, m_side {side} {}
+
+		private:
+			// throws std::bad_alloc on collision, after the arena reported it
+			inline auto do_allocate(std::size_t bytes, std::size_t alignment) -> void* override;
+			inline auto do_deallocate(void*, std::size_t, std::size_t) -> void override {}
+			inline auto do_is_equal(const std::pmr::memory_resource &other) const noexcept -> bool override {
+				const LevelArenaMemoryResource *resource {dynamic_cast<const LevelArenaMemoryResource*> (&other)};
+				if (resource == nullptr)
+					return false;
+				return m_arena == resource->m_arena && m_side == resource->m_side;
+			}
+
+			LevelArena *m_arena;
+			DoubleStackSide m_side;
+	};
+
+
+	/*
+	 * Splits one block of memory between the data that lives as long as the level, allocated upward from the
+	 * bottom, and the scratch memory used while loading it, allocated downward from the top. Scratch data that
+	 * turns out to be needed for the whole level can be promoted, which copies it down to the persistent side.
+	 * When the two sides would overlap, the allocation fails and the collision is reported
+	 */
+	class SL_CORE LevelArena final {
+		public:
+			using value_type = DoubleStackAllocator::value_type;
+			using pointer = DoubleStackAllocator::pointer;
+			using size_type = DoubleStackAllocator::size_type;
+			using Marker = DoubleStackAllocator::Marker;
+			using CollisionCallback = std::function<void(const LevelArenaCollision&)>;
+
+			LevelArena(sl::utils::Bytes size) noexcept;
+			~LevelArena() = default;
+
+			LevelArena(const LevelArena &) noexcept = delete;
+			auto operator=(const LevelArena &) noexcept -> LevelArena& = delete;
+			LevelArena(LevelArena &&) noexcept = delete;
+			auto operator=(LevelArena &&) noexcept -> LevelArena& = delete;
+
+			// Both return nullptr on collision
+			[[nodiscard]]
+			auto allocatePersistent(size_type size, size_type alignment) noexcept -> pointer;
+			[[nodiscard]]
+			auto allocateScratch(size_type size, size_type alignment) noexcept -> pointer;
+			/*
+			 * Copies `size` bytes of scratch memory to a new persistent allocation and returns it, or nullptr on
+			 * collision. The scratch allocation stays valid until the scratch side is released
+			 */
+			[[nodiscard]]
+			auto promote(const void *scratch, size_type size, size_type alignment) noexcept -> pointer;
+
+			[[nodiscard]]
+			inline auto markPersistent() const noexcept -> Marker {return m_allocator.mark(DoubleStackSide::eBottom);}
+			[[nodiscard]]
+			inline auto markScratch() const noexcept -> Marker {return m_allocator.mark(DoubleStackSide::eTop);}
+			inline auto release(Marker marker) noexcept -> void {m_allocator.deallocate(marker);}
+			// Frees the whole scratch side, once the level is loaded
+			inline auto releaseScratch() noexcept -> void {m_allocator.deallocate(m_scratchStart);}
+			// Frees both sides, when the level is unloaded
+			inline auto reset() noexcept -> void {m_allocator.deallocate(m_persistentStart); m_allocator.deallocate(m_scratchStart);}
+
+			inline auto getPersistentResource() noexcept -> LevelArenaMemoryResource& {return m_persistentResource;}
+			inline auto getScratchResource() noexcept -> LevelArenaMemoryResource& {return m_scratchResource;}
+
+			inline auto setCollisionCallback(CollisionCallback callback) noexcept -> void {m_collisionCallback = std::move(callback);}
+			inline auto getCollisionCount() const noexcept -> size_type {return m_collisionCount;}
+			inline auto getLastCollision() const noexcept -> const LevelArenaCollision& {return m_lastCollision;}
+			inline auto getFreeSize() const noexcept -> sl::utils::Bytes {return m_allocator.getFreeSize();}
+
+		private:
+			auto m_allocate(size_type size, size_type alignment, DoubleStackSide side) noexcept -> pointer;
+
+			DoubleStackAllocator m_allocator;
+			Marker m_persistentStart;
+			Marker m_scratchStart;
+			LevelArenaMemoryResource m_persistentResource;
+			LevelArenaMemoryResource m_scratchResource;
+			CollisionCallback m_collisionCallback;
+			size_type m_collisionCount;
+			LevelArenaCollision m_lastCollision;
+	};
+
+
+	// defined once LevelArena is complete, and inline like the other memory resources so it needs no export
+	inline auto LevelArenaMemoryResource::do_allocate(std::size_t bytes, std::size_t alignment) -> void* {
+		void *ptr {m_side == DoubleStackSide::eBottom
+			? m_arena->allocatePersistent(bytes, alignment)
+			: m_arena->allocateScratch(bytes, alignment)
+		};
+		if (ptr == nullptr)
+			throw std::bad_alloc();
+		return ptr;
+	}
+
+} // namespace sl::memory
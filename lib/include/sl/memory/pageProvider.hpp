@@ -0,0 +1,60 @@
+#pragma once
+
+#include <cstddef>
+#include <limits>
+
+#include "sl/core.hpp"
+#include "sl/utils/units.hpp"
+
+
+namespace sl::memory {
+	using namespace sl::utils::literals;
+
+	enum class HugePageMode {
+		eNone,
+		// asks the OS to back the memory with huge pages when it can (madvise(MADV_HUGEPAGE) on Linux)
+		eTransparent,
+		// takes the memory from the reserved huge pages (MAP_HUGETLB, MEM_LARGE_PAGES), or falls back to eTransparent
+		eExplicit
+	};
+
+	constexpr std::size_t NO_NUMA_NODE {std::numeric_limits<std::size_t>::max()};
+
+	struct PageProviderCreateInfos {
+		HugePageMode hugePages {HugePageMode::eNone};
+		// touches every page on allocation, so that the first sweep of the memory doesn't page fault
+		bool prefault {false};
+		// NUMA node the memory is placed on when it's first touched, NO_NUMA_NODE lets the OS pick
+		std::size_t numaNode {NO_NUMA_NODE};
+	};
+
+
+	/*
+	 * Gives out memory straight from the OS, with control over the size of the pages backing it and where it
+	 * is placed. Sizes are rounded up to the granularity of the provider, which is the huge page size when
+	 * huge pages are asked for
+	 */
+	class SL_CORE PageProvider final {
+		public:
+			PageProvider(const PageProviderCreateInfos &createInfos = {}) noexcept;
+			~PageProvider() = default;
+
+			PageProvider(const PageProvider &) noexcept = default;
+			auto operator=(const PageProvider &) noexcept -> PageProvider& = default;
+			PageProvider(PageProvider &&) noexcept = default;
+			auto operator=(PageProvider &&) noexcept -> PageProvider& = default;
+
+			// Returns `size` bytes aligned on the granularity of the provider, or nullptr
+			[[nodiscard]]
+			auto allocate(sl::utils::Bytes size) const noexcept -> std::byte*;
+			// `size` must be the one given to allocate()
+			auto deallocate(std::byte *address, sl::utils::Bytes size) const noexcept -> void;
+
+			auto getGranularity() const noexcept -> sl::utils::Bytes;
+			inline auto getCreateInfos() const noexcept -> const PageProviderCreateInfos& {return m_createInfos;}
+
+		private:
+			PageProviderCreateInfos m_createInfos;
+	};
+
+} // namespace sl::memory
@@ -1,8 +1,12 @@
 #pragma once
 
+#include <atomic>
 #include <cstddef>
-#include <map>
+#include <cstdint>
+#include <limits>
+#include <vector>
 
+#include "sl/memory/allocatorStats.hpp"
 #include "sl/memory/allocatorTraits.hpp"
 
 
@@ -66,7 +70,15 @@ namespace sl::memory {
 			using difference_type = std::ptrdiff_t;
 			using is_always_equal = std::false_type;
 
-			PoolAllocator(size_type size) noexcept;
+			static constexpr size_type UNLIMITED_CHUNK_COUNT {std::numeric_limits<size_type>::max()};
+
+			/*
+			 * The pool starts with one chunk of `chunkSize` slots, and adds new chunks when it's full until it
+			 * holds `maxChunkCount` of them. Slots never move, even when a chunk is added. Each chunk holds exactly
+			 * `chunkSize` slots, but indices are spaced as if it was rounded up to a power of two, so that finding a
+			 * slot from its index is a shift and a mask
+			 */
+			PoolAllocator(size_type chunkSize, size_type maxChunkCount = 1) noexcept;
 			~PoolAllocator();
 
 			PoolAllocator(const PoolAllocator<T> &allocator) noexcept;
@@ -80,22 +92,77 @@ namespace sl::memory {
 
 			template <typename ...Args>
 			[[nodiscard]]
-			auto allocateIt(Args &&...args) noexcept {return PoolAllocatorIterator<T> (*this, this->allocate(1, std::forward<Args> (args)...) - m_pool);}
+			auto allocateIt(Args &&...args) noexcept {
+				return PoolAllocatorIterator<T> (*this, static_cast<difference_type> (this->m_findIndex(this->allocate(1, std::forward<Args> (args)...))));
+			}
 
-			inline auto operator==(const PoolAllocator<T> &allocator) const noexcept {return m_instanceID == allocator.m_instanceID;}
+			inline auto operator==(const PoolAllocator<T> &allocator) const noexcept {return m_control == allocator.m_control;}
 
-			inline auto begin() noexcept {return PoolAllocatorIterator<T> (*this, 0);}
-			inline auto end() noexcept {return PoolAllocatorIterator<T> (*this, static_cast<difference_type> (m_poolSize));}
+			inline auto begin() noexcept {return PoolAllocatorIterator<T> (*this, static_cast<difference_type> (this->m_findNextLive(0)));}
+			inline auto end() noexcept {return PoolAllocatorIterator<T> (*this, static_cast<difference_type> (this->m_getSize()));}
 
 
 		protected:
-			size_type m_poolSize;
-			value_type *m_pool;
-			bool *m_poolState;
-			size_type m_instanceID;
-
-			static size_type s_lastInstanceID;
-			static std::map<size_type, size_type> s_instanceCounts;
+			/*
+			 * A free slot stores the index of the next free slot in place, so that allocate and deallocate
+			 * don't have to search for a free slot
+			 */
+			union Slot {
+				alignas(T) std::byte value[sizeof(T)];
+				size_type nextFree;
+			};
+
+			struct Chunk {
+				Slot *slots;
+				size_type firstIndex;
+			};
+
+			/*
+			 * Shared between the copies of an allocator, and freed with the last of them. Slots at or after
+			 * `untouchedIndex` were never allocated and aren't part of the free list yet. The indices between
+			 * `chunkSize` and the next power of two of each chunk are never used. Only the reference count may be
+			 * touched by copies living on different threads
+			 */
+			struct ControlBlock {
+				std::atomic<size_type> referenceCount;
+				size_type chunkSize;
+				size_type chunkSizeLog2;
+				size_type maxChunkCount;
+				size_type freeListHead;
+				size_type untouchedIndex;
+				std::vector<Slot*> chunks;
+				// the same chunks sorted by address, to find the index of a slot from its pointer
+				std::vector<Chunk> chunksByAddress;
+				// one bit per slot, only used for iteration
+				std::vector<std::uint64_t> state;
+				[[no_unique_address]]
+				sl::memory::AllocatorStatsTracker stats {"PoolAllocator"};
+			};
+
+			static constexpr size_type STATE_WORD_BITS {64};
+			static constexpr size_type NO_SLOT {std::numeric_limits<size_type>::max()};
+
+			inline auto m_getSize() const noexcept -> size_type {
+				return m_control == nullptr ? 0 : m_control->chunks.size() << m_control->chunkSizeLog2;
+			}
+			inline auto m_getSlot(size_type index) const noexcept -> Slot& {
+				const size_type chunkSizeLog2 {m_control->chunkSizeLog2};
+				return m_control->chunks[index >> chunkSizeLog2][index & ((static_cast<size_type> (1) << chunkSizeLog2) - 1)];
+			}
+			inline auto m_isLive(size_type index) const noexcept -> bool {
+				return (m_control->state[index / STATE_WORD_BITS] >> (index % STATE_WORD_BITS)) & 1;
+			}
+			// Returns the index of the first live slot at or after `index`, or the size of the pool if there is none
+			inline auto m_findNextLive(size_type index) const noexcept -> size_type;
+			// Returns the index of the last live slot before `index`, or the size of the pool if there is none
+			inline auto m_findPreviousLive(size_type index) const noexcept -> size_type;
+			// Returns the index of the slot `ptr` points to, or NO_SLOT if it's not part of the pool
+			inline auto m_findIndex(const_pointer ptr) const noexcept -> size_type;
+			inline auto m_addChunk() noexcept -> bool;
+			// Drops this allocator's reference to the control block, and frees it if it was the last one
+			inline auto m_release() noexcept -> void;
+
+			ControlBlock *m_control;
 	};
 
 	static_assert(sl::memory::IsAllocator<PoolAllocator<char>>);
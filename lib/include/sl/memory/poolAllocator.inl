@@ -1,5 +1,9 @@
 #pragma once
 
+#include <algorithm>
+#include <bit>
+#include <cstdlib>
+
 #include "sl/memory/poolAllocator.hpp"
 #include "sl/utils/assert.hpp"
 
@@ -13,10 +17,9 @@ namespace sl::memory {
 
 	template <typename T>
 	auto PoolAllocatorIterator<T>::operator++() noexcept -> PoolAllocatorIterator<T>& {
-		while (
-			static_cast<PoolAllocator<T>::size_type> (m_position) < m_allocator->m_poolSize &&
-			!m_allocator->m_poolState[++m_position]
-		);
+		using size_type = typename PoolAllocator<T>::size_type;
+		if (static_cast<size_type> (m_position) < m_allocator->m_getSize())
+			m_position = static_cast<difference_type> (m_allocator->m_findNextLive(static_cast<size_type> (m_position) + 1));
 		return *this;
 	}
 
@@ -31,7 +34,10 @@ namespace sl::memory {
 
 	template <typename T>
 	auto PoolAllocatorIterator<T>::operator--() noexcept -> PoolAllocatorIterator<T>& {
-		while (m_position > 0 && !m_allocator->m_poolState[--m_position]);
+		using size_type = typename PoolAllocator<T>::size_type;
+		const size_type position {m_allocator->m_findPreviousLive(static_cast<size_type> (m_position))};
+		if (position != m_allocator->m_getSize())
+			m_position = static_cast<difference_type> (position);
 		return *this;
 	}
 
@@ -46,13 +52,13 @@ namespace sl::memory {
 
 	template <typename T>
 	auto PoolAllocatorIterator<T>::operator*() const noexcept -> reference {
-		return m_allocator->m_pool[m_position];
+		return *this->operator->();
 	}
 
 
 	template <typename T>
 	auto PoolAllocatorIterator<T>::operator->() const noexcept -> pointer {
-		return m_allocator->m_pool + m_position;
+		return reinterpret_cast<pointer> (m_allocator->m_getSlot(static_cast<PoolAllocator<T>::size_type> (m_position)).value);
 	}
 
 
@@ -68,52 +74,38 @@ namespace sl::memory {
 
 
 	template <typename T>
-	PoolAllocator<T>::PoolAllocator(size_type size) noexcept :
-		m_poolSize {size},
-		m_pool {reinterpret_cast<T*> (std::malloc(sizeof(T) * m_poolSize))},
-		m_poolState {reinterpret_cast<bool*> (std::malloc(sizeof(bool) * m_poolSize))},
-		m_instanceID {++s_lastInstanceID}
+	PoolAllocator<T>::PoolAllocator(size_type chunkSize, size_type maxChunkCount) noexcept :
+		m_control {new ControlBlock{1, chunkSize, static_cast<size_type> (std::bit_width(chunkSize - 1)), maxChunkCount, NO_SLOT, 0, {}, {}, {}}}
 	{
-		s_instanceCounts[m_instanceID] = 1;
-		for (size_type i {0}; i < m_poolSize; ++i)
-			m_poolState[i] = false;
+		SL_TEXT_ASSERT(chunkSize != 0 && maxChunkCount != 0, "PoolAllocator must be able to hold at least one slot");
+		(void)this->m_addChunk();
 	}
 
 
 	template <typename T>
 	PoolAllocator<T>::~PoolAllocator() {
-		if (m_instanceID == 0)
-			return;
-		if (--s_instanceCounts[m_instanceID] != 0)
-			return;
-
-		m_instanceID = 0;
-		std::free(m_poolState);
-		std::free(m_pool);
-		m_poolSize = 0;
+		this->m_release();
 	}
 
 
 	template <typename T>
 	PoolAllocator<T>::PoolAllocator(const PoolAllocator<T> &allocator) noexcept :
-		m_poolSize {allocator.m_poolSize},
-		m_pool {allocator.m_pool},
-		m_poolState {allocator.m_poolState},
-		m_instanceID {allocator.m_instanceID}
+		m_control {allocator.m_control}
 	{
-		++s_instanceCounts[m_instanceID];
+		if (m_control != nullptr)
+			m_control->referenceCount.fetch_add(1, std::memory_order_relaxed);
 	}
 
 
 	template <typename T>
 	PoolAllocator<T> &PoolAllocator<T>::operator=(const PoolAllocator<T> &allocator) noexcept {
-		this->~PoolAllocator<T>();
+		if (m_control == allocator.m_control)
+			return *this;
+		this->m_release();
 
-		m_poolSize = allocator.m_poolSize;
-		m_pool = allocator.m_pool;
-		m_poolState = allocator.m_poolState;
-		m_instanceID = allocator.m_instanceID;
-		++s_instanceCounts[m_instanceID];
+		m_control = allocator.m_control;
+		if (m_control != nullptr)
+			m_control->referenceCount.fetch_add(1, std::memory_order_relaxed);
 
 		return *this;
 	}
@@ -121,31 +113,20 @@ namespace sl::memory {
 
 	template <typename T>
 	PoolAllocator<T>::PoolAllocator(PoolAllocator<T> &&allocator) noexcept :
-		m_poolSize {allocator.m_poolSize},
-		m_pool {allocator.m_pool},
-		m_poolState {allocator.m_poolState},
-		m_instanceID {allocator.m_instanceID}
+		m_control {allocator.m_control}
 	{
-		allocator.m_poolSize = 0;
-		allocator.m_pool = nullptr;
-		allocator.m_poolState = nullptr;
-		allocator.m_instanceID = 0;
+		allocator.m_control = nullptr;
 	}
 
 
 	template <typename T>
 	PoolAllocator<T> &PoolAllocator<T>::operator=(PoolAllocator<T> &&allocator) noexcept {
-		this->~PoolAllocator<T>();
+		if (this == &allocator)
+			return *this;
+		this->m_release();
 
-		m_poolSize = allocator.m_poolSize;
-		m_pool = allocator.m_pool;
-		m_poolState = allocator.m_poolState;
-		m_instanceID = allocator.m_instanceID;
-
-		allocator.m_poolSize = 0;
-		allocator.m_pool = nullptr;
-		allocator.m_poolState = nullptr;
-		allocator.m_instanceID = 0;
+		m_control = allocator.m_control;
+		allocator.m_control = nullptr;
 
 		return *this;
 	}
@@ -156,15 +137,24 @@ namespace sl::memory {
 	auto PoolAllocator<T>::allocate(size_type n) noexcept -> pointer {
 		SL_TEXT_ASSERT(n == 1, "n of PoolAllocator->allocate must be 1");
 
-		for (size_type i {0}; i < m_poolSize; ++i) {
-			if (m_poolState[i])
-				continue;
-
-			m_poolState[i] = true;
-			return m_pool + i;
+		size_type index {m_control->freeListHead};
+		if (index != NO_SLOT)
+			m_control->freeListHead = this->m_getSlot(index).nextFree;
+		else if (m_control->untouchedIndex != this->m_getSize() || this->m_addChunk()) {
+			index = m_control->untouchedIndex++;
+			// skips the unused end of the chunk's index range
+			const size_type chunkMask {(static_cast<size_type> (1) << m_control->chunkSizeLog2) - 1};
+			if ((m_control->untouchedIndex & chunkMask) == m_control->chunkSize)
+				m_control->untouchedIndex = (m_control->untouchedIndex + chunkMask) & ~chunkMask;
+		}
+		else {
+			m_control->stats.onFailedAllocation();
+			return nullptr;
 		}
 
-		return nullptr;
+		m_control->stats.onAllocation(sizeof(T));
+		m_control->state[index / STATE_WORD_BITS] |= static_cast<std::uint64_t> (1) << (index % STATE_WORD_BITS);
+		return reinterpret_cast<pointer> (this->m_getSlot(index).value);
 	}
 
 
@@ -172,20 +162,109 @@ namespace sl::memory {
 	auto PoolAllocator<T>::deallocate(pointer ptr, size_type n) noexcept -> void {
 		SL_TEXT_ASSERT(n == 1, "n of PoolAllocator->deallocate must be 1");
 
-		difference_type diff {ptr - m_pool};
-		if (diff < 0)
-			return;
-		size_type index {static_cast<size_type> (diff)};
-		if (index >= m_poolSize)
+		const size_type index {this->m_findIndex(ptr)};
+		if (index == NO_SLOT || !this->m_isLive(index))
 			return;
 
-		m_poolState[index] = false;
+		m_control->stats.onDeallocation(sizeof(T));
+		m_control->state[index / STATE_WORD_BITS] &= ~(static_cast<std::uint64_t> (1) << (index % STATE_WORD_BITS));
+		this->m_getSlot(index).nextFree = m_control->freeListHead;
+		m_control->freeListHead = index;
 	}
 
 
 	template <typename T>
-	typename PoolAllocator<T>::size_type PoolAllocator<T>::s_lastInstanceID {0};
+	auto PoolAllocator<T>::m_findNextLive(size_type index) const noexcept -> size_type {
+		const size_type size {this->m_getSize()};
+		if (index >= size)
+			return size;
+
+		size_type wordIndex {index / STATE_WORD_BITS};
+		// bits past the size of the pool are never set, so the last word doesn't need masking
+		std::uint64_t word {m_control->state[wordIndex] & (~static_cast<std::uint64_t> (0) << (index % STATE_WORD_BITS))};
+		const size_type wordCount {m_control->state.size()};
+		while (word == 0) {
+			if (++wordIndex == wordCount)
+				return size;
+			word = m_control->state[wordIndex];
+		}
+
+		return wordIndex * STATE_WORD_BITS + static_cast<size_type> (std::countr_zero(word));
+	}
+
+
 	template <typename T>
-	std::map<typename PoolAllocator<T>::size_type, typename PoolAllocator<T>::size_type> PoolAllocator<T>::s_instanceCounts {};
+	auto PoolAllocator<T>::m_findPreviousLive(size_type index) const noexcept -> size_type {
+		const size_type size {this->m_getSize()};
+		if (index == 0 || size == 0)
+			return size;
+		if (index > size)
+			index = size;
+
+		--index;
+		size_type wordIndex {index / STATE_WORD_BITS};
+		std::uint64_t word {m_control->state[wordIndex] & (~static_cast<std::uint64_t> (0) >> (STATE_WORD_BITS - 1 - index % STATE_WORD_BITS))};
+		while (word == 0) {
+			if (wordIndex == 0)
+				return size;
+			word = m_control->state[--wordIndex];
+		}
+
+		return wordIndex * STATE_WORD_BITS + STATE_WORD_BITS - 1 - static_cast<size_type> (std::countl_zero(word));
+	}
+
+
+	template <typename T>
+	auto PoolAllocator<T>::m_findIndex(const_pointer ptr) const noexcept -> size_type {
+		if (ptr == nullptr || m_control == nullptr)
+			return NO_SLOT;
+
+		const Slot *slot {reinterpret_cast<const Slot*> (ptr)};
+		const auto &chunks {m_control->chunksByAddress};
+		auto it {std::ranges::upper_bound(chunks, slot, std::less<> {}, [](const Chunk &chunk) -> const Slot* {return chunk.slots;})};
+		if (it == chunks.begin())
+			return NO_SLOT;
+
+		--it;
+		const difference_type offset {slot - it->slots};
+		if (offset >= static_cast<difference_type> (m_control->chunkSize))
+			return NO_SLOT;
+		return it->firstIndex + static_cast<size_type> (offset);
+	}
+
+
+	template <typename T>
+	auto PoolAllocator<T>::m_addChunk() noexcept -> bool {
+		if (m_control->chunks.size() >= m_control->maxChunkCount)
+			return false;
+
+		Slot *slots {reinterpret_cast<Slot*> (std::malloc(sizeof(Slot) * m_control->chunkSize))};
+		if (slots == nullptr)
+			return false;
+
+		const Chunk newChunk {slots, this->m_getSize()};
+		m_control->chunks.push_back(slots);
+		m_control->chunksByAddress.insert(
+			std::ranges::upper_bound(m_control->chunksByAddress, slots, std::less<> {}, [](const Chunk &chunk) -> const Slot* {return chunk.slots;}),
+			newChunk
+		);
+		m_control->state.resize((this->m_getSize() + STATE_WORD_BITS - 1) / STATE_WORD_BITS, 0);
+		m_control->stats.setCapacity(m_control->chunks.size() * m_control->chunkSize * sizeof(T));
+		return true;
+	}
+
+
+	template <typename T>
+	auto PoolAllocator<T>::m_release() noexcept -> void {
+		if (m_control == nullptr)
+			return;
+
+		if (m_control->referenceCount.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+			for (Slot *chunk : m_control->chunks)
+				std::free(chunk);
+			delete m_control;
+		}
+		m_control = nullptr;
+	}
 
 } // namespace sl::memory
@@ -14,6 +14,7 @@ namespace sl::memory {
 			using difference_type = sl::memory::StackAllocator::difference_type;
 
 			inline SingleFrameAllocator(sl::utils::Bytes size = 16_MiB) noexcept : m_stackAllocator {size} {}
+			inline SingleFrameAllocator(const sl::memory::StackAllocatorCreateInfos &createInfos) noexcept : m_stackAllocator {createInfos} {}
 			inline ~SingleFrameAllocator() = default;
 
 			inline SingleFrameAllocator(const SingleFrameAllocator &) noexcept = delete;
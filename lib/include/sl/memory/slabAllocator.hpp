@@ -0,0 +1,159 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <new>
+#include <vector>
+
+#include "sl/core.hpp"
+#include "sl/memory/allocatorStats.hpp"
+#include "sl/memory/allocatorTraits.hpp"
+#include "sl/memory/pageProvider.hpp"
+#include "sl/utils/units.hpp"
+
+
+namespace sl::memory {
+	using namespace sl::utils::literals;
+
+	struct SlabAllocatorCreateInfos {
+		// each size class takes its blocks from slabs of this size
+		sl::utils::Bytes slabSize {64_kiB};
+		sl::memory::PageProviderCreateInfos pages {};
+		// serves the allocations bigger than the largest size class
+		std::pmr::memory_resource *upstream {std::pmr::new_delete_resource()};
+	};
+
+
+	/*
+	 * Serves small objects of any size from one pool per size class. Size classes go up by powers of two
+	 * split in four steps, so that past 32 bytes a block is never more than 25% bigger than the size asked for.
+	 * Each class pops its blocks from an intrusive free list, or carves them out of its current slab.
+	 * Not thread safe
+	 */
+	class SL_CORE SlabAllocator final {
+		public:
+			using value_type = std::byte;
+			using pointer = value_type*;
+			using const_pointer = const value_type*;
+			using size_type = std::size_t;
+			using difference_type = std::ptrdiff_t;
+
+			static constexpr std::array<size_type, 15> SIZE_CLASSES {16, 24, 32, 40, 48, 56, 64, 80, 96, 112, 128, 160, 192, 224, 256};
+			static constexpr size_type MAX_SIZE_CLASS {SIZE_CLASSES.back()};
+
+			SlabAllocator(const SlabAllocatorCreateInfos &createInfos = {}) noexcept;
+			~SlabAllocator();
+
+			SlabAllocator(const SlabAllocator &) noexcept = delete;
+			auto operator=(const SlabAllocator &) noexcept -> SlabAllocator& = delete;
+			SlabAllocator(SlabAllocator &&allocator) noexcept;
+			auto operator=(SlabAllocator &&allocator) noexcept -> SlabAllocator&;
+
+			[[nodiscard]]
+			auto allocate(size_type size, size_type alignment = alignof(std::max_align_t)) noexcept -> pointer;
+			// `size` and `alignment` must be the ones given to allocate()
+			auto deallocate(pointer ptr, size_type size, size_type alignment = alignof(std::max_align_t)) noexcept -> void;
+
+			// Returns the size of the blocks that serve `size` bytes aligned on `alignment`, or 0 if it goes upstream
+			static auto getBlockSize(size_type size, size_type alignment = alignof(std::max_align_t)) noexcept -> size_type;
+			inline auto getSlabCount() const noexcept -> size_type {return m_slabs.size();}
+
+		private:
+			static constexpr size_type NO_SIZE_CLASS {SIZE_CLASSES.size()};
+			static constexpr size_type SIZE_CLASS_GRANULARITY {8};
+
+			struct FreeBlock {
+				FreeBlock *next;
+			};
+
+			struct SizeClass {
+				FreeBlock *freeList;
+				pointer slabTop;
+				pointer slabEnd;
+			};
+
+			static auto s_getSizeClassIndex(size_type size, size_type alignment) noexcept -> size_type;
+			auto m_addSlab(SizeClass &sizeClass) noexcept -> bool;
+			// Frees every slab, leaving the allocator empty
+			auto m_release() noexcept -> void;
+
+			sl::utils::Bytes m_slabSize;
+			sl::memory::PageProvider m_pageProvider;
+			std::pmr::memory_resource *m_upstream;
+			std::array<SizeClass, SIZE_CLASSES.size()> m_sizeClasses;
+			std::vector<pointer> m_slabs;
+			[[no_unique_address]]
+			sl::memory::AllocatorStatsTracker m_stats;
+	};
+
+
+	template <typename T>
+	class SlabAllocatorView {
+		public:
+			using value_type = T;
+			using pointer = value_type*;
+			using const_pointer = const value_type*;
+			using reference = value_type&;
+			using const_reference = const value_type&;
+			using size_type = SlabAllocator::size_type;
+			using difference_type = SlabAllocator::difference_type;
+			using is_always_equal = std::false_type;
+
+			inline SlabAllocatorView(SlabAllocator &slabAllocator) noexcept : m_slabAllocator {&slabAllocator} {}
+			template <typename U>
+			inline SlabAllocatorView(const SlabAllocatorView<U> &view) noexcept : m_slabAllocator {view.m_slabAllocator} {}
+			inline SlabAllocatorView(const SlabAllocatorView<T> &) noexcept = default;
+			inline auto operator=(const SlabAllocatorView<T> &) noexcept -> SlabAllocatorView<T>& = default;
+			inline SlabAllocatorView(SlabAllocatorView<T> &&) noexcept = default;
+			inline auto operator=(SlabAllocatorView<T> &&) noexcept -> SlabAllocatorView<T>& = default;
+
+			[[nodiscard]]
+			inline auto allocate(size_type n) const noexcept -> pointer {return reinterpret_cast<pointer> (m_slabAllocator->allocate(sizeof(T) * n, alignof(T)));}
+			inline auto deallocate(pointer ptr, size_type n) const noexcept -> void {
+				m_slabAllocator->deallocate(reinterpret_cast<SlabAllocator::pointer> (ptr), sizeof(T) * n, alignof(T));
+			}
+
+			template <typename U>
+			inline auto operator==(const SlabAllocatorView<U> &view) const noexcept -> bool {return m_slabAllocator == view.m_slabAllocator;}
+
+		private:
+			template <typename U>
+			friend class SlabAllocatorView;
+
+			SlabAllocator *m_slabAllocator;
+	};
+
+	static_assert(sl::memory::IsAllocator<SlabAllocatorView<char>>);
+
+
+	class SlabMemoryResource final : public std::pmr::memory_resource {
+		public:
+			inline SlabMemoryResource(SlabAllocator &slabAllocator) noexcept : m_slabAllocator {&slabAllocator} {}
+			inline SlabMemoryResource(const SlabMemoryResource &) noexcept = default;
+			inline auto operator=(const SlabMemoryResource &) noexcept -> SlabMemoryResource& = default;
+			inline SlabMemoryResource(SlabMemoryResource &&) noexcept = default;
+			inline auto operator=(SlabMemoryResource &&) noexcept -> SlabMemoryResource& = default;
+
+		private:
+			inline auto do_allocate(std::size_t bytes, std::size_t alignment) -> void* override {
+				void *ptr {m_slabAllocator->allocate(bytes, alignment)};
+				if (ptr == nullptr)
+					throw std::bad_alloc();
+				return ptr;
+			}
+			inline auto do_deallocate(void *ptr, std::size_t bytes, std::size_t alignment) -> void override {
+				m_slabAllocator->deallocate(reinterpret_cast<SlabAllocator::pointer> (ptr), bytes, alignment);
+			}
+			inline auto do_is_equal(const std::pmr::memory_resource &other) const noexcept -> bool override {
+				const SlabMemoryResource *resource {dynamic_cast<const SlabMemoryResource*> (&other)};
+				if (resource == nullptr)
+					return false;
+				return m_slabAllocator == resource->m_slabAllocator;
+			}
+
+			SlabAllocator *m_slabAllocator;
+	};
+
+} // namespace sl::memory
@@ -1,7 +1,13 @@
 #pragma once
 
+#include <limits>
+#include <memory_resource>
+#include <new>
+
 #include "sl/core.hpp"
+#include "sl/memory/allocatorStats.hpp"
 #include "sl/memory/allocatorTraits.hpp"
+#include "sl/memory/pageProvider.hpp"
 #include "sl/utils/units.hpp"
 
 
@@ -33,6 +39,20 @@ namespace sl::memory {
 	};
 
 
+	struct StackAllocatorCreateInfos {
+		sl::utils::Bytes size {16_MiB};
+		/*
+		 * Only reserves `size` bytes of address space, and commits memory as the top of the stack advances.
+		 * Can be used to size a stack for the worst case without paying for it until it's needed
+		 */
+		bool isVirtual {false};
+		// With `isVirtual`, clear() decommits the memory committed above this size
+		sl::utils::Bytes highWaterMark {std::numeric_limits<std::size_t>::max()};
+		// Backing of the stack when it isn't virtual
+		sl::memory::PageProviderCreateInfos pages {};
+	};
+
+
 	class SL_CORE StackAllocator {
 		public:
 			using value_type = std::byte;
@@ -43,6 +63,7 @@ namespace sl::memory {
 			using Marker = StackAllocatorMarker;
 
 			StackAllocator(sl::utils::Bytes size = 16_MiB) noexcept;
+			StackAllocator(const StackAllocatorCreateInfos &createInfos) noexcept;
 			~StackAllocator();
 
 			StackAllocator(const StackAllocator &) noexcept = delete;
@@ -59,10 +80,27 @@ namespace sl::memory {
 			auto deallocate(Marker marker) noexcept -> void;
 			auto clear() noexcept -> void;
 
+			inline auto getUsedSize() const noexcept -> sl::utils::Bytes {return static_cast<size_type> (m_stackTop - m_stackBase);}
+			inline auto owns(const_pointer ptr) const noexcept -> bool {return ptr >= m_stackBase && ptr < m_stackBase + m_stackSize;}
+			inline auto getCommittedSize() const noexcept -> sl::utils::Bytes {return static_cast<size_type> (m_committedTop - m_stackBase);}
+
 		private:
+			// commit at least this much memory at once, to avoid a system call every page
+			static constexpr size_type MIN_COMMIT_SIZE {64 * 1024};
+
+			auto m_commitUpTo(pointer top) noexcept -> bool;
+			// Frees the stack, leaving an allocator of size 0
+			auto m_release() noexcept -> void;
+
 			sl::utils::Bytes m_stackSize;
 			pointer m_stackBase;
 			pointer m_stackTop;
+			pointer m_committedTop;
+			bool m_isVirtual;
+			sl::utils::Bytes m_highWaterMark;
+			sl::memory::PageProvider m_pageProvider;
+			[[no_unique_address]]
+			sl::memory::AllocatorStatsTracker m_stats;
 	};
 
 
@@ -113,7 +151,12 @@ namespace sl::memory {
 			inline auto operator=(StackMemoryResource &&) noexcept -> StackMemoryResource& = default;
 
 		private:
-			inline auto do_allocate(std::size_t bytes, std::size_t alignment) -> void* override {return m_allocator->allocate(bytes, alignment);}
+			inline auto do_allocate(std::size_t bytes, std::size_t alignment) -> void* override {
+				void *ptr {m_allocator->allocate(bytes, alignment)};
+				if (ptr == nullptr)
+					throw std::bad_alloc();
+				return ptr;
+			}
 			inline auto do_deallocate(void*, std::size_t, std::size_t) -> void override {}
 			inline auto do_is_equal(const std::pmr::memory_resource &other) const noexcept -> bool override {
 				const StackMemoryResource *resource {dynamic_cast<const StackMemoryResource*> (&other)};
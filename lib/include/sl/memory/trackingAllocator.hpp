@@ -0,0 +1,215 @@
+#pragma once
+
+#include <cstddef>
+#include <iostream>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "sl/core.hpp"
+#include "sl/memory/allocatorTraits.hpp"
+#include "sl/utils/units.hpp"
+
+
+namespace sl::memory {
+	using namespace sl::utils::literals;
+
+	struct MemoryTrackerCreateInfos {
+		// a callstack is captured every `callstackSamplingPeriod` allocations, 0 never captures any
+		std::size_t callstackSamplingPeriod {64};
+		// dumps the leaks and the invalid deallocations to std::cerr when the tracker is destroyed
+		bool reportOnDestruction {true};
+	};
+
+	struct TrackedAllocation {
+		const void *address;
+		sl::utils::Bytes size;
+		std::size_t alignment;
+		std::size_t frameIndex;
+		std::string_view tag;
+		// empty if the allocation wasn't sampled
+		std::vector<void*> callstack;
+	};
+
+	struct InvalidDeallocation {
+		const void *address;
+		std::size_t frameIndex;
+		std::string_view tag;
+		// false if the address was never allocated through the tracker
+		bool isDoubleFree;
+	};
+
+	struct TagUsage {
+		std::string_view tag;
+		sl::utils::Bytes liveSize;
+		std::size_t liveCount;
+		sl::utils::Bytes peakSize;
+		std::size_t allocationCount;
+	};
+
+
+	/*
+	 * Records every live allocation made through the TrackingAllocator and TrackingMemoryResource that refer to
+	 * it, to find leaks, double frees, and which tag the memory goes to. Tags must outlive the tracker, which
+	 * is the case of string literals. Meant for debug builds, as every allocation goes through a mutex
+	 */
+	class SL_CORE MemoryTracker final {
+		public:
+			MemoryTracker(const MemoryTrackerCreateInfos &createInfos = {}) noexcept;
+			~MemoryTracker();
+
+			MemoryTracker(const MemoryTracker &) noexcept = delete;
+			auto operator=(const MemoryTracker &) noexcept -> MemoryTracker& = delete;
+			MemoryTracker(MemoryTracker &&) noexcept = delete;
+			auto operator=(MemoryTracker &&) noexcept -> MemoryTracker& = delete;
+
+			auto onAllocation(const void *address, sl::utils::Bytes size, std::size_t alignment, std::string_view tag) noexcept -> void;
+			// Returns false if `address` isn't a live allocation, in which case it must not reach the allocator
+			[[nodiscard]]
+			auto onDeallocation(const void *address, std::string_view tag) noexcept -> bool;
+			/*
+			 * Forgets the live allocations of `tag`, for allocators that release their memory at once like
+			 * StackAllocator::clear()
+			 */
+			auto onBulkDeallocation(std::string_view tag) noexcept -> void;
+			auto endFrame() noexcept -> void;
+
+			auto getFrameIndex() const noexcept -> std::size_t;
+			// Live allocations sorted by address, which are leaks if the allocators are done with them
+			auto getLiveAllocations() const noexcept -> std::vector<TrackedAllocation>;
+			auto getInvalidDeallocations() const noexcept -> std::vector<InvalidDeallocation>;
+			// Usage of every tag, sorted by decreasing live size
+			auto getTagUsages() const noexcept -> std::vector<TagUsage>;
+			auto report(std::ostream &stream = std::cerr) const noexcept -> void;
+
+		private:
+			static constexpr std::size_t MAX_CALLSTACK_DEPTH {16};
+			// how many of the last deallocated addresses are remembered to tell double frees from unknown pointers
+			static constexpr std::size_t FREED_ADDRESS_HISTORY_SIZE {4096};
+
+			static auto s_captureCallstack() noexcept -> std::vector<void*>;
+			static auto s_printCallstack(std::ostream &stream, const std::vector<void*> &callstack) noexcept -> void;
+
+			// Must be called with `m_mutex` locked
+			auto m_recordFreedAddress(const void *address) noexcept -> void;
+
+			mutable std::mutex m_mutex;
+			std::size_t m_callstackSamplingPeriod;
+			bool m_reportOnDestruction;
+			std::size_t m_frameIndex;
+			std::size_t m_allocationCount;
+			std::unordered_map<const void*, TrackedAllocation> m_liveAllocations;
+			// ring of the last deallocated addresses, a live address is never reported so they don't need to be removed
+			std::vector<const void*> m_freedAddresses;
+			std::size_t m_freedAddressCursor;
+			std::vector<InvalidDeallocation> m_invalidDeallocations;
+			std::unordered_map<std::string_view, TagUsage> m_tagUsages;
+	};
+
+
+	/*
+	 * Wraps any allocator to report its allocations to a MemoryTracker. Invalid deallocations are recorded
+	 * and never forwarded to the wrapped allocator. Handles that aren't raw pointers are tracked through
+	 * `getHandle()` when they have one, so that HeapAllocator blocks stay tracked when they are defragmented
+	 */
+	template <sl::memory::IsAllocator Alloc>
+	class TrackingAllocator final {
+		public:
+			using value_type = typename std::allocator_traits<Alloc>::value_type;
+			using pointer = typename std::allocator_traits<Alloc>::pointer;
+			using const_pointer = typename std::allocator_traits<Alloc>::const_pointer;
+			using reference = value_type&;
+			using const_reference = const value_type&;
+			using size_type = typename std::allocator_traits<Alloc>::size_type;
+			using difference_type = typename std::allocator_traits<Alloc>::difference_type;
+			using is_always_equal = std::false_type;
+
+			inline TrackingAllocator(const Alloc &allocator, MemoryTracker &tracker, std::string_view tag = "untagged") noexcept :
+				m_allocator {allocator},
+				m_tracker {&tracker},
+				m_tag {tag}
+			{}
+			inline ~TrackingAllocator() = default;
+
+			inline TrackingAllocator(const TrackingAllocator<Alloc> &) noexcept = default;
+			inline auto operator=(const TrackingAllocator<Alloc> &) noexcept -> TrackingAllocator<Alloc>& = default;
+			inline TrackingAllocator(TrackingAllocator<Alloc> &&) noexcept = default;
+			inline auto operator=(TrackingAllocator<Alloc> &&) noexcept -> TrackingAllocator<Alloc>& = default;
+
+			[[nodiscard]]
+			inline auto allocate(size_type n) noexcept -> pointer {
+				pointer ptr {m_allocator.allocate(n)};
+				if (const void *address {s_getAddress(ptr)}; address != nullptr)
+					m_tracker->onAllocation(address, sizeof(value_type) * n, alignof(value_type), m_tag);
+				return ptr;
+			}
+			inline auto deallocate(const pointer &ptr, size_type n) noexcept -> void {
+				if (const void *address {s_getAddress(ptr)}; address != nullptr && !m_tracker->onDeallocation(address, m_tag))
+					return;
+				m_allocator.deallocate(ptr, n);
+			}
+
+			inline auto getAllocator() const noexcept -> const Alloc& {return m_allocator;}
+			inline auto getTracker() const noexcept -> MemoryTracker& {return *m_tracker;}
+			inline auto getTag() const noexcept -> std::string_view {return m_tag;}
+
+			inline auto operator==(const TrackingAllocator<Alloc> &allocator) const noexcept -> bool {
+				return m_allocator == allocator.m_allocator && m_tracker == allocator.m_tracker;
+			}
+
+		private:
+			static inline auto s_getAddress(const pointer &ptr) noexcept -> const void* {
+				if constexpr (std::is_pointer_v<pointer>)
+					return ptr;
+				else if constexpr (requires {ptr.getHandle();})
+					return ptr.getHandle();
+				else
+					return std::to_address(ptr);
+			}
+
+			Alloc m_allocator;
+			MemoryTracker *m_tracker;
+			std::string_view m_tag;
+	};
+
+
+	class TrackingMemoryResource final : public std::pmr::memory_resource {
+		public:
+			inline TrackingMemoryResource(std::pmr::memory_resource &upstream, MemoryTracker &tracker, std::string_view tag = "untagged") noexcept :
+				m_upstream {&upstream},
+				m_tracker {&tracker},
+				m_tag {tag}
+			{}
+			inline TrackingMemoryResource(const TrackingMemoryResource &) noexcept = default;
+			inline auto operator=(const TrackingMemoryResource &) noexcept -> TrackingMemoryResource& = default;
+			inline TrackingMemoryResource(TrackingMemoryResource &&) noexcept = default;
+			inline auto operator=(TrackingMemoryResource &&) noexcept -> TrackingMemoryResource& = default;
+
+		private:
+			inline auto do_allocate(std::size_t bytes, std::size_t alignment) -> void* override {
+				void *ptr {m_upstream->allocate(bytes, alignment)};
+				if (ptr != nullptr)
+					m_tracker->onAllocation(ptr, bytes, alignment, m_tag);
+				return ptr;
+			}
+			inline auto do_deallocate(void *ptr, std::size_t bytes, std::size_t alignment) -> void override {
+				if (ptr != nullptr && !m_tracker->onDeallocation(ptr, m_tag))
+					return;
+				m_upstream->deallocate(ptr, bytes, alignment);
+			}
+			inline auto do_is_equal(const std::pmr::memory_resource &other) const noexcept -> bool override {
+				const TrackingMemoryResource *resource {dynamic_cast<const TrackingMemoryResource*> (&other)};
+				if (resource == nullptr)
+					return false;
+				return m_upstream->is_equal(*resource->m_upstream) && m_tracker == resource->m_tracker;
+			}
+
+			std::pmr::memory_resource *m_upstream;
+			MemoryTracker *m_tracker;
+			std::string_view m_tag;
+	};
+
+} // namespace sl::memory
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <cstddef>
+
+#include "sl/core.hpp"
+#include "sl/utils/units.hpp"
+
+
+namespace sl::memory {
+	/*
+	 * Thin wrappers around the virtual memory of the OS. Reserved memory takes address space only, and must
+	 * be committed before being touched. All sizes and addresses must be multiples of the page size
+	 */
+	SL_CORE auto getVirtualMemoryPageSize() noexcept -> sl::utils::Bytes;
+
+	[[nodiscard]]
+	SL_CORE auto reserveVirtualMemory(sl::utils::Bytes size) noexcept -> std::byte*;
+	SL_CORE auto releaseVirtualMemory(std::byte *address, sl::utils::Bytes size) noexcept -> void;
+
+	[[nodiscard]]
+	SL_CORE auto commitVirtualMemory(std::byte *address, sl::utils::Bytes size) noexcept -> bool;
+	// Gives the physical memory back to the OS. The range stays reserved and can be committed again
+	SL_CORE auto decommitVirtualMemory(std::byte *address, sl::utils::Bytes size) noexcept -> void;
+
+} // namespace sl::memory
@@ -0,0 +1,10 @@
+#pragma once
+
+#include "sl/core.hpp"
+
+
+namespace sl::utils {
+	// Whether the CPU and the OS support AVX2. Always false outside of x86-64. The result is computed once
+	SL_CORE auto hasAVX2() noexcept -> bool;
+
+} // namespace sl::utils
@@ -137,9 +137,7 @@ struct std::formatter<sl::utils::FlagField<Enum>> {
 		auto it {ctx.begin()};
 		if (it == ctx.end())
 			return it;
-		sl::String text {};
-		text.reserve(ctx.end() - ctx.begin());
-		text.pushBack(it, ctx.end() - 1);
+		const sl::utils::StringView text {&*it, static_cast<std::size_t> (ctx.end() - 1 - it)};
 		it = ctx.end() - 1;
 		if (text.isEmpty())
 			return it;
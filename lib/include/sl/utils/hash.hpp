@@ -1,13 +1,45 @@
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
 #include <format>
 #include <ostream>
 #include <sstream>
 
+#include "sl/core.hpp"
 #include "sl/utils/string.hpp"
 
 
 namespace sl::utils {
+	/*
+	 * Inputs longer than HASH_LONG_THRESHOLD bytes are hashed by 8 lanes of 64-bit accumulators, each stripe of 64 bytes
+	 * feeding every lane. The stripe `i` of a block is keyed by HASH_LONG_KEY[i, i + 8), so that reordering the stripes
+	 * changes the hash, and HASH_LONG_KEY[16, 24) keys the scrambling of the accumulators after each block. The lanes
+	 * being independent, the runtime version uses SSE2 or AVX2 on x86-64
+	 */
+	namespace simd {
+		inline constexpr std::size_t HASH_LONG_THRESHOLD {256};
+		inline constexpr std::size_t HASH_STRIPE_SIZE {64};
+		inline constexpr std::size_t HASH_STRIPES_PER_BLOCK {16};
+		inline constexpr std::uint64_t HASH_SCRAMBLE_PRIME {0x9e3779b1};
+		inline constexpr std::uint64_t HASH_LONG_KEY[HASH_STRIPES_PER_BLOCK + 8] {
+			0x7e290896c424bb7cull, 0xf0f1588a2360e275ull, 0xb606852810538d76ull, 0x6531d05de4a5ec16ull,
+			0xc8a2f88f300ae89dull, 0xd1c619812773ed00ull, 0x63654cef6daf0681ull, 0xc02315719fddc7b8ull,
+			0x2cb0f69f4abea221ull, 0x9417034723148989ull, 0xdd555950609dfe03ull, 0xdbafb150deb12800ull,
+			0x7e789b2e6c442cb6ull, 0xf41e5636c7e4f8c4ull, 0x0959d150f8fba7e4ull, 0xa97316f13cdb9eeaull,
+			0x74cd8258f9520068ull, 0x55c74a62e116868bull, 0xd2f4c799a2023cbdull, 0xdf98cb79a37b51b9ull,
+			0x396f5885524f3905ull, 0xaf1d56386ca3b276ull, 0xa9ffbe6b5104e85aull, 0x6bd0c51b9fd533b3ull
+		};
+		inline constexpr std::uint64_t HASH_LONG_INIT[8] {
+			0x64df5697d55bf18full, 0x7e44ebc85fd11239ull, 0x3b5689bd31d4e954ull, 0x4ae67954563a8e38ull,
+			0x349c417e2eca283cull, 0x300173cdb6356427ull, 0x72a8a8abbef3a214ull, 0x73ee3d6ebadbac2cull
+		};
+
+		// `size` must be greater than HASH_LONG_THRESHOLD
+		SL_CORE auto hashAccumulate(const char *data, std::size_t size, std::uint64_t (&accumulators)[8]) noexcept -> void;
+	} // namespace simd
+
+
 	template <std::unsigned_integral T>
 	class Hash {
 		public:
@@ -38,13 +70,15 @@ namespace sl::utils {
 	};
 
 
-	template <std::unsigned_integral T, typename CharT, sl::memory::IsAllocator Alloc>
-	constexpr auto hash(const sl::utils::BasicString<CharT, Alloc> &string) noexcept -> Hash<T>;
+	template <std::unsigned_integral T, typename CharT, sl::memory::IsAllocator Alloc, std::size_t SSO_CAPACITY>
+	constexpr auto hash(const sl::utils::BasicString<CharT, Alloc, SSO_CAPACITY> &string) noexcept -> Hash<T>;
 	template <std::unsigned_integral T>
 	constexpr auto hash(const char *str, std::size_t N) noexcept -> Hash<T>;
 
-	template <IsHash Hash, typename CharT, sl::memory::IsAllocator Alloc>
-	constexpr auto hash(const sl::utils::BasicString<CharT, Alloc> &string) noexcept -> Hash {return hash<typename Hash::HashType, CharT, Alloc> (string);}
+	template <IsHash Hash, typename CharT, sl::memory::IsAllocator Alloc, std::size_t SSO_CAPACITY>
+	constexpr auto hash(const sl::utils::BasicString<CharT, Alloc, SSO_CAPACITY> &string) noexcept -> Hash {
+		return hash<typename Hash::HashType, CharT, Alloc, SSO_CAPACITY> (string);
+	}
 	template <IsHash Hash>
 	constexpr auto hash(const char *str, std::size_t N) noexcept -> Hash {return hash<typename Hash::HashType> (str, N);}
 
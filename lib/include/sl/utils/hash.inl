@@ -2,61 +2,191 @@
 
 #include "sl/utils/hash.hpp"
 
+#include <bit>
+#include <cstring>
+#include <type_traits>
+
 
 namespace sl::utils {
-	template <std::unsigned_integral T, typename CharT, sl::memory::IsAllocator Alloc>
-	constexpr auto hash(const sl::utils::BasicString<CharT, Alloc> &string) noexcept -> Hash<T> {
-		T hash {};
-		T word {};
-		std::size_t wordPosition {};
-		constexpr std::size_t CHAR_PER_WORD {sizeof(T) / sizeof(CharT)};
-
-		for (auto it {string.begin()}; it != string.end(); ++it) {
-			if (wordPosition < CHAR_PER_WORD - 1) {
-				word |= static_cast<T> (*it) << (sizeof(CharT) * wordPosition);
-				++wordPosition;
-				continue;
+	inline constexpr std::uint64_t __hash_SECRET[4] {
+		0x2d358dccaa6c78a5ull, 0x8bb84b93962eacc9ull, 0x4b33a62ed433d4a3ull, 0x4d5a2da51de1aa47ull
+	};
+
+
+	// 64x64 -> 128 bits multiplication, returns the low and high halves in `lhs` and `rhs`
+	constexpr auto __hash_multiply(std::uint64_t &lhs, std::uint64_t &rhs) noexcept -> void {
+	#ifdef __SIZEOF_INT128__
+		__extension__ typedef unsigned __int128 UInt128;
+		const UInt128 result {static_cast<UInt128> (lhs) * rhs};
+		lhs = static_cast<std::uint64_t> (result);
+		rhs = static_cast<std::uint64_t> (result >> 64);
+	#else
+		const std::uint64_t lhsHigh {lhs >> 32}, lhsLow {lhs & 0xffffffff};
+		const std::uint64_t rhsHigh {rhs >> 32}, rhsLow {rhs & 0xffffffff};
+		const std::uint64_t lowLow {lhsLow * rhsLow}, lowHigh {lhsLow * rhsHigh};
+		const std::uint64_t highLow {lhsHigh * rhsLow}, highHigh {lhsHigh * rhsHigh};
+		const std::uint64_t middle {(lowLow >> 32) + (lowHigh & 0xffffffff) + (highLow & 0xffffffff)};
+		lhs = (middle << 32) | (lowLow & 0xffffffff);
+		rhs = highHigh + (lowHigh >> 32) + (highLow >> 32) + (middle >> 32);
+	#endif
+	}
+
+
+	constexpr auto __hash_mix(std::uint64_t lhs, std::uint64_t rhs) noexcept -> std::uint64_t {
+		__hash_multiply(lhs, rhs);
+		return lhs ^ rhs;
+	}
+
+
+	// Reads `COUNT` bytes of the little-endian representation of the string, starting at the byte `offset`
+	template <std::size_t COUNT, typename CharT>
+	constexpr auto __hash_read(const CharT *str, std::size_t offset) noexcept -> std::uint64_t {
+		if constexpr (sizeof(CharT) == 1 && std::endian::native == std::endian::little) {
+			if (!std::is_constant_evaluated()) {
+				std::uint64_t value {0};
+				std::memcpy(&value, str + offset, COUNT);
+				return value;
 			}
+		}
+
+		std::uint64_t value {0};
+		for (std::size_t i {0}; i < COUNT; ++i) {
+			const std::size_t byte {offset + i};
+			const auto character {static_cast<std::make_unsigned_t<CharT>> (str[byte / sizeof(CharT)])};
+			value |= static_cast<std::uint64_t> ((character >> (8 * (byte % sizeof(CharT)))) & 0xff) << (8 * i);
+		}
+		return value;
+	}
 
-			word |= static_cast<T> (*it) << (sizeof(CharT) * (CHAR_PER_WORD - 1));
-			hash ^= word;
 
-			word = 0;
-			wordPosition = 0;
+	template <typename CharT>
+	constexpr auto __hash_accumulateStripe(
+		std::uint64_t (&accumulators)[8],
+		const CharT *str,
+		std::size_t offset,
+		std::size_t keyOffset
+	) noexcept -> void {
+		for (std::size_t lane {0}; lane < 8; ++lane) {
+			const std::uint64_t value {__hash_read<8> (str, offset + lane * 8)};
+			const std::uint64_t keyed {value ^ simd::HASH_LONG_KEY[keyOffset + lane]};
+			accumulators[lane ^ 1] += value;
+			accumulators[lane] += (keyed & 0xffffffff) * (keyed >> 32);
 		}
+	}
 
-		if (wordPosition != 0)
-			hash ^= word;
 
-		return Hash<T> (hash);
+	constexpr auto __hash_scramble(std::uint64_t (&accumulators)[8]) noexcept -> void {
+		for (std::size_t lane {0}; lane < 8; ++lane) {
+			accumulators[lane] ^= accumulators[lane] >> 47;
+			accumulators[lane] ^= simd::HASH_LONG_KEY[simd::HASH_STRIPES_PER_BLOCK + lane];
+			accumulators[lane] *= simd::HASH_SCRAMBLE_PRIME;
+		}
 	}
 
 
-	template <std::unsigned_integral T>
-	constexpr auto hash(const char *str, std::size_t N) noexcept -> Hash<T> {
-		T hash {};
-		T word {};
-		std::size_t wordPosition {};
-		constexpr std::size_t CHAR_PER_WORD {sizeof(T) / sizeof(char)};
-
-		for (std::size_t i {0}; i != N; ++i) {
-			if (wordPosition < CHAR_PER_WORD - 1) {
-				word |= static_cast<T> (str[i]) << (sizeof(char) * wordPosition);
-				++wordPosition;
-				continue;
+	/*
+	 * Scalar version of simd::hashAccumulate, used at compile time and for the characters wider than a byte. Both
+	 * must give the exact same result
+	 */
+	template <typename CharT>
+	constexpr auto __hash_accumulate(const CharT *str, std::size_t size, std::uint64_t (&accumulators)[8]) noexcept -> void {
+		const std::size_t stripeCount {(size - 1) / simd::HASH_STRIPE_SIZE};
+		for (std::size_t stripe {0}; stripe < stripeCount; ++stripe) {
+			__hash_accumulateStripe(accumulators, str, stripe * simd::HASH_STRIPE_SIZE, stripe % simd::HASH_STRIPES_PER_BLOCK);
+			if ((stripe + 1) % simd::HASH_STRIPES_PER_BLOCK == 0)
+				__hash_scramble(accumulators);
+		}
+		__hash_accumulateStripe(accumulators, str, size - simd::HASH_STRIPE_SIZE, stripeCount % simd::HASH_STRIPES_PER_BLOCK);
+	}
+
+
+	// wyhash for the short inputs, and 8 lanes of 64-bits accumulators for the long ones. `size` is in bytes
+	template <typename CharT>
+	constexpr auto __hash_bytes(const CharT *str, std::size_t size) noexcept -> std::uint64_t {
+		std::uint64_t seed {__hash_mix(__hash_SECRET[0], __hash_SECRET[1])};
+
+		if (size > simd::HASH_LONG_THRESHOLD) {
+			std::uint64_t accumulators[8] {};
+			for (std::size_t lane {0}; lane < 8; ++lane)
+				accumulators[lane] = simd::HASH_LONG_INIT[lane];
+
+			bool done {false};
+			if constexpr (sizeof(CharT) == 1) {
+				if (!std::is_constant_evaluated()) {
+					simd::hashAccumulate(reinterpret_cast<const char*> (str), size, accumulators);
+					done = true;
+				}
 			}
+			if (!done)
+				__hash_accumulate(str, size, accumulators);
+
+			std::uint64_t result {seed ^ (size * __hash_SECRET[0])};
+			for (std::size_t lane {0}; lane < 8; lane += 2)
+				result = __hash_mix(accumulators[lane] ^ __hash_SECRET[1], accumulators[lane + 1] ^ result);
+			return __hash_mix(result ^ __hash_SECRET[0], size ^ __hash_SECRET[1]);
+		}
 
-			word |= static_cast<T> (str[i]) << (sizeof(char) * (CHAR_PER_WORD - 1));
-			hash ^= word;
+		std::uint64_t a {0};
+		std::uint64_t b {0};
+		if (size <= 16) {
+			if (size >= 4) {
+				const std::size_t middle {(size >> 3) << 2};
+				a = (__hash_read<4> (str, 0) << 32) | __hash_read<4> (str, middle);
+				b = (__hash_read<4> (str, size - 4) << 32) | __hash_read<4> (str, size - 4 - middle);
+			}
+			else if (size > 0) {
+				a = (__hash_read<1> (str, 0) << 16) | (__hash_read<1> (str, size >> 1) << 8) | __hash_read<1> (str, size - 1);
+			}
+		}
+		else {
+			std::size_t offset {0};
+			std::size_t remaining {size};
+			if (remaining > 48) {
+				std::uint64_t seed1 {seed};
+				std::uint64_t seed2 {seed};
+				do {
+					seed = __hash_mix(__hash_read<8> (str, offset) ^ __hash_SECRET[1], __hash_read<8> (str, offset + 8) ^ seed);
+					seed1 = __hash_mix(__hash_read<8> (str, offset + 16) ^ __hash_SECRET[2], __hash_read<8> (str, offset + 24) ^ seed1);
+					seed2 = __hash_mix(__hash_read<8> (str, offset + 32) ^ __hash_SECRET[3], __hash_read<8> (str, offset + 40) ^ seed2);
+					offset += 48;
+					remaining -= 48;
+				} while (remaining > 48);
+				seed ^= seed1 ^ seed2;
+			}
 
-			word = 0;
-			wordPosition = 0;
+			while (remaining > 16) {
+				seed = __hash_mix(__hash_read<8> (str, offset) ^ __hash_SECRET[1], __hash_read<8> (str, offset + 8) ^ seed);
+				offset += 16;
+				remaining -= 16;
+			}
+			a = __hash_read<8> (str, offset + remaining - 16);
+			b = __hash_read<8> (str, offset + remaining - 8);
 		}
 
-		if (wordPosition != 0)
-			hash ^= word;
+		a ^= __hash_SECRET[1];
+		b ^= seed;
+		__hash_multiply(a, b);
+		return __hash_mix(a ^ __hash_SECRET[0] ^ size, b ^ __hash_SECRET[1]);
+	}
+
 
-		return Hash<T> (hash);
+	template <std::unsigned_integral T>
+	constexpr auto __hash_fold(std::uint64_t hash) noexcept -> T {
+		if constexpr (sizeof(T) < sizeof(std::uint64_t))
+			hash ^= hash >> 32;
+		return static_cast<T> (hash);
+	}
+
+
+	template <std::unsigned_integral T, typename CharT, sl::memory::IsAllocator Alloc, std::size_t SSO_CAPACITY>
+	constexpr auto hash(const sl::utils::BasicString<CharT, Alloc, SSO_CAPACITY> &string) noexcept -> Hash<T> {
+		return Hash<T> (__hash_fold<T> (__hash_bytes(string.getData(), string.getSize() * sizeof(CharT))));
+	}
+
+
+	template <std::unsigned_integral T>
+	constexpr auto hash(const char *str, std::size_t N) noexcept -> Hash<T> {
+		return Hash<T> (__hash_fold<T> (__hash_bytes(str, N)));
 	}
 
 } // namespace sl::utils
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <algorithm>
+#include <bit>
 #include <cstddef>
 #include <cstring>
 #include <type_traits>
@@ -19,6 +21,14 @@ namespace sl::utils {
 
 	template <typename T, typename Ptr = T*>
 	constexpr auto memset(Ptr dest, const T &value, std::size_t count) -> void {
+		if constexpr (std::contiguous_iterator<Ptr> && std::is_trivially_copyable_v<T>) {
+			if (!std::is_constant_evaluated()) {
+				if constexpr (sizeof(T) == 1)
+					return (void)std::memset(std::to_address(dest), std::bit_cast<unsigned char> (value), count);
+				else
+					return (void)std::fill_n(std::to_address(dest), count, value);
+			}
+		}
 		for (std::size_t i {0}; i < count; ++i)
 			dest[i] = value;
 	}
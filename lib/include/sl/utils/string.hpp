@@ -1,12 +1,16 @@
 #pragma once
 
+#include <algorithm>
+#include <compare>
 #include <cstddef>
 #include <cstring>
 #include <optional>
+#include <string>
 
 #include "sl/memory/allocator.hpp"
 #include "sl/utils/iterator.hpp"
 #include "sl/utils/numberWrapper.hpp"
+#include "sl/utils/stringView.hpp"
 
 
 namespace sl::utils {
@@ -14,16 +18,28 @@ namespace sl::utils {
 	class ConcatStringView;
 
 
+	// inline capacity that fits in the space of the heap pointer and capacity, so that the default SSO costs no memory
+	template <typename CharT>
+	constexpr std::size_t BASIC_STRING_DEFAULT_SSO_CAPACITY {(sizeof(CharT*) + sizeof(std::size_t)) / sizeof(CharT)};
+
+
 	/**
 	 * @brief A class that handles strings in Steelux
+	 * @tparam SSO_CAPACITY Minimal number of characters, null-terminating character included, stored inline before
+	 *         the string moves to the heap. It is rounded up to the size of the heap pointer and capacity, which share
+	 *         their memory with the inline buffer. With `sl::memory::NullAllocator`, the string never leaves the inline
+	 *         buffer and the insertions that don't fit are truncated
 	 */
-	template <typename CharT, sl::memory::IsAllocator Alloc = sl::memory::DefaultAllocator<CharT>>
+	template <typename CharT, sl::memory::IsAllocator Alloc = sl::memory::DefaultAllocator<CharT>, std::size_t SSO_CAPACITY = BASIC_STRING_DEFAULT_SSO_CAPACITY<CharT>>
 	class BasicString final {
 		template <typename T>
 		static constexpr bool IsRange = std::ranges::range<T>
-			&& !std::convertible_to<T, BasicString<CharT, Alloc>>
+			&& !std::convertible_to<T, BasicString<CharT, Alloc, SSO_CAPACITY>>
 			&& !std::convertible_to<T, CharT*>
-			&& !std::convertible_to<T, const CharT*>;
+			&& !std::convertible_to<T, const CharT*>
+			&& !std::convertible_to<T, BasicStringView<CharT>>;
+
+		static constexpr bool IS_INLINE {std::same_as<Alloc, sl::memory::NullAllocator<CharT>>};
 
 		public:
 			using value_type = CharT;
@@ -35,35 +51,48 @@ namespace sl::utils {
 			using pointer = std::allocator_traits<Alloc>::pointer;
 			using const_pointer = std::allocator_traits<Alloc>::const_pointer;
 
-			using iterator = sl::utils::TwoTypesContinousIterator<BasicString<CharT, Alloc>, CharT, pointer>;
-			using const_iterator = sl::utils::TwoTypesContinousIterator<const BasicString<CharT, Alloc>, const CharT, const_pointer>;
-			using reverse_iterator = sl::utils::ReverseTwoTypesContinousIterator<BasicString<CharT, Alloc>, CharT, pointer>;
-			using const_reverse_iterator = sl::utils::ReverseTwoTypesContinousIterator<const BasicString<CharT, Alloc>, const CharT, const_pointer>;
+			using iterator = sl::utils::TwoTypesContinousIterator<BasicString<CharT, Alloc, SSO_CAPACITY>, CharT, pointer>;
+			using const_iterator = sl::utils::TwoTypesContinousIterator<const BasicString<CharT, Alloc, SSO_CAPACITY>, const CharT, const_pointer>;
+			using reverse_iterator = sl::utils::ReverseTwoTypesContinousIterator<BasicString<CharT, Alloc, SSO_CAPACITY>, CharT, pointer>;
+			using const_reverse_iterator = sl::utils::ReverseTwoTypesContinousIterator<const BasicString<CharT, Alloc, SSO_CAPACITY>, const CharT, const_pointer>;
 
 
 			constexpr BasicString(const Alloc &alloc = Alloc()) noexcept;
 			constexpr BasicString(const CharT *str, const Alloc &alloc = Alloc()) noexcept;
 			constexpr BasicString(const CharT *str, size_type size, const Alloc &alloc = Alloc()) noexcept;
+			constexpr explicit BasicString(BasicStringView<CharT> str, const Alloc &alloc = Alloc()) noexcept :
+				BasicString<CharT, Alloc, SSO_CAPACITY> (str.getData(), str.getSize(), alloc)
+			{}
 			constexpr ~BasicString();
 
-			constexpr BasicString(const BasicString<CharT, Alloc> &str) noexcept;
-			constexpr auto operator=(const BasicString<CharT, Alloc> &str) noexcept -> BasicString<CharT, Alloc>&;
-			constexpr BasicString(BasicString<CharT, Alloc> &&str) noexcept;
-			constexpr auto operator=(BasicString<CharT, Alloc> &&str) noexcept -> BasicString<CharT, Alloc>&;
+			constexpr BasicString(const BasicString<CharT, Alloc, SSO_CAPACITY> &str) noexcept;
+			constexpr auto operator=(const BasicString<CharT, Alloc, SSO_CAPACITY> &str) noexcept -> BasicString<CharT, Alloc, SSO_CAPACITY>&;
+			constexpr BasicString(BasicString<CharT, Alloc, SSO_CAPACITY> &&str) noexcept;
+			constexpr auto operator=(BasicString<CharT, Alloc, SSO_CAPACITY> &&str) noexcept -> BasicString<CharT, Alloc, SSO_CAPACITY>&;
 
 			template <typename ...Types>
 			requires std::same_as<Alloc, typename ConcatStringView<Types...>::Allocator>
 			constexpr BasicString(const ConcatStringView<Types...> &csv) noexcept;
 			template <typename ...Types>
 			requires std::same_as<Alloc, typename ConcatStringView<Types...>::Allocator>
-			constexpr auto operator=(const ConcatStringView<Types...> &csv) noexcept -> BasicString<CharT, Alloc>&;
+			constexpr auto operator=(const ConcatStringView<Types...> &csv) noexcept -> BasicString<CharT, Alloc, SSO_CAPACITY>&;
 
-			template <sl::memory::IsAllocator Alloc2>
-			constexpr auto operator==(const BasicString<CharT, Alloc2> &str) const noexcept -> bool;
+			template <sl::memory::IsAllocator Alloc2, std::size_t SSO_CAPACITY2>
+			constexpr auto operator==(const BasicString<CharT, Alloc2, SSO_CAPACITY2> &str) const noexcept -> bool;
 			constexpr auto operator==(const CharT *str) const noexcept -> bool;
+			constexpr auto operator==(BasicStringView<CharT> str) const noexcept -> bool {return BasicStringView<CharT> (*this) == str;}
 			template <typename ...Types>
 			constexpr auto operator==(const ConcatStringView<Types...> &csv) const noexcept -> bool;
 
+			template <sl::memory::IsAllocator Alloc2, std::size_t SSO_CAPACITY2>
+			constexpr auto compare(const BasicString<CharT, Alloc2, SSO_CAPACITY2> &str) const noexcept -> std::strong_ordering {return this->m_compare(str.getData(), str.getSize());}
+			constexpr auto compare(const CharT *str) const noexcept -> std::strong_ordering {return this->m_compare(str, std::char_traits<CharT>::length(str));}
+			constexpr auto compare(BasicStringView<CharT> str) const noexcept -> std::strong_ordering {return this->m_compare(str.getData(), str.getSize());}
+			template <sl::memory::IsAllocator Alloc2, std::size_t SSO_CAPACITY2>
+			constexpr auto operator<=>(const BasicString<CharT, Alloc2, SSO_CAPACITY2> &str) const noexcept -> std::strong_ordering {return this->compare(str);}
+			constexpr auto operator<=>(const CharT *str) const noexcept -> std::strong_ordering {return this->compare(str);}
+			constexpr auto operator<=>(BasicStringView<CharT> str) const noexcept -> std::strong_ordering {return this->compare(str);}
+
 			constexpr auto reserve(size_type newSize) noexcept -> size_type;
 			constexpr auto shrinkToFit() noexcept -> size_type;
 
@@ -79,28 +108,34 @@ namespace sl::utils {
 			constexpr auto pushFront(CharT value, size_type count = 1) noexcept -> iterator {return this->insert(this->begin(), value, count);}
 			constexpr auto pushBack(CharT value, size_type count = 1) noexcept -> iterator {return this->insert(this->end(), value, count);}
 
-			template <sl::memory::IsAllocator Alloc2>
-			constexpr auto insert(difference_type position, const sl::utils::BasicString<CharT, Alloc2> &str) noexcept -> iterator;
-			template <sl::memory::IsAllocator Alloc2>
-			constexpr auto insert(const iterator &position, const sl::utils::BasicString<CharT, Alloc2> &str) noexcept -> iterator {return this->insert(position - this->begin(), str);}
-			template <sl::memory::IsAllocator Alloc2>
-			constexpr auto insert(const reverse_iterator &position, const sl::utils::BasicString<CharT, Alloc2> &str) noexcept -> iterator {
+			template <sl::memory::IsAllocator Alloc2, std::size_t SSO_CAPACITY2>
+			constexpr auto insert(difference_type position, const sl::utils::BasicString<CharT, Alloc2, SSO_CAPACITY2> &str) noexcept -> iterator;
+			template <sl::memory::IsAllocator Alloc2, std::size_t SSO_CAPACITY2>
+			constexpr auto insert(const iterator &position, const sl::utils::BasicString<CharT, Alloc2, SSO_CAPACITY2> &str) noexcept -> iterator {return this->insert(position - this->begin(), str);}
+			template <sl::memory::IsAllocator Alloc2, std::size_t SSO_CAPACITY2>
+			constexpr auto insert(const reverse_iterator &position, const sl::utils::BasicString<CharT, Alloc2, SSO_CAPACITY2> &str) noexcept -> iterator {
 				return this->insert(this->rbegin() - position - 1, str);
 			}
-			template <sl::memory::IsAllocator Alloc2>
-			constexpr auto pushFront(const sl::utils::BasicString<CharT, Alloc2> &str) noexcept -> iterator {return this->insert(this->begin(), str);}
-			template <sl::memory::IsAllocator Alloc2>
-			constexpr auto pushBack(const sl::utils::BasicString<CharT, Alloc2> &str) noexcept -> iterator {return this->insert(this->end(), str);}
-
-			constexpr auto insert(difference_type position, const CharT *str) noexcept -> iterator {return this->insert(position, BasicString(str, this->m_copyAllocator()));}
-			constexpr auto insert(const iterator &position, const CharT *str) noexcept -> iterator {return this->insert(position, BasicString(str, this->m_copyAllocator()));}
-			constexpr auto insert(const reverse_iterator &position, const CharT *str) noexcept -> iterator {return this->insert(position, BasicString(str, this->m_copyAllocator()));}
-			constexpr auto pushFront(const CharT *str) noexcept -> iterator {return this->pushFront(BasicString(str, this->m_copyAllocator()));}
-			constexpr auto pushBack(const CharT *str) noexcept -> iterator {return this->pushBack(BasicString(str, this->m_copyAllocator()));}
-
-			template <sl::memory::IsAllocator Alloc2>
-			constexpr auto operator+=(const sl::utils::BasicString<CharT, Alloc2> &str) noexcept -> BasicString<CharT, Alloc>& {(void)this->pushBack(str); return *this;}
-			constexpr auto operator+=(const CharT *str) noexcept -> BasicString<CharT, Alloc>& {(void)this->pushBack(str); return *this;}
+			template <sl::memory::IsAllocator Alloc2, std::size_t SSO_CAPACITY2>
+			constexpr auto pushFront(const sl::utils::BasicString<CharT, Alloc2, SSO_CAPACITY2> &str) noexcept -> iterator {return this->insert(this->begin(), str);}
+			template <sl::memory::IsAllocator Alloc2, std::size_t SSO_CAPACITY2>
+			constexpr auto pushBack(const sl::utils::BasicString<CharT, Alloc2, SSO_CAPACITY2> &str) noexcept -> iterator {return this->m_append(str.getData(), str.getSize());}
+
+			constexpr auto insert(difference_type position, const CharT *str) noexcept -> iterator {return this->m_insert(position, str, std::char_traits<CharT>::length(str));}
+			constexpr auto insert(const iterator &position, const CharT *str) noexcept -> iterator {return this->insert(position - this->begin(), str);}
+			constexpr auto insert(const reverse_iterator &position, const CharT *str) noexcept -> iterator {return this->insert(this->rbegin() - position - 1, str);}
+			constexpr auto pushFront(const CharT *str) noexcept -> iterator {return this->insert(0, str);}
+			constexpr auto pushBack(const CharT *str) noexcept -> iterator {return this->m_append(str, std::char_traits<CharT>::length(str));}
+
+			constexpr auto insert(difference_type position, BasicStringView<CharT> str) noexcept -> iterator {return this->m_insert(position, str.getData(), str.getSize());}
+			constexpr auto insert(const iterator &position, BasicStringView<CharT> str) noexcept -> iterator {return this->insert(position - this->begin(), str);}
+			constexpr auto pushFront(BasicStringView<CharT> str) noexcept -> iterator {return this->insert(0, str);}
+			constexpr auto pushBack(BasicStringView<CharT> str) noexcept -> iterator {return this->m_append(str.getData(), str.getSize());}
+
+			template <sl::memory::IsAllocator Alloc2, std::size_t SSO_CAPACITY2>
+			constexpr auto operator+=(const sl::utils::BasicString<CharT, Alloc2, SSO_CAPACITY2> &str) noexcept -> BasicString<CharT, Alloc, SSO_CAPACITY>& {(void)this->pushBack(str); return *this;}
+			constexpr auto operator+=(const CharT *str) noexcept -> BasicString<CharT, Alloc, SSO_CAPACITY>& {(void)this->pushBack(str); return *this;}
+			constexpr auto operator+=(BasicStringView<CharT> str) noexcept -> BasicString<CharT, Alloc, SSO_CAPACITY>& {(void)this->pushBack(str); return *this;}
 
 			template <std::forward_iterator IT>
 			requires std::convertible_to<typename std::iterator_traits<IT>::value_type, CharT>
@@ -135,6 +170,45 @@ namespace sl::utils {
 			constexpr auto popFront(size_type count = 1) noexcept -> iterator {return this->erase(this->begin(), count);}
 			constexpr auto popBack(size_type count = 1) noexcept -> iterator {return this->erase(this->end() - count, count);}
 
+			// Searches return the index of the first character of the match
+			constexpr auto find(CharT value, size_type start = 0) const noexcept -> std::optional<size_type>;
+			template <sl::memory::IsAllocator Alloc2, std::size_t SSO_CAPACITY2>
+			constexpr auto find(const BasicString<CharT, Alloc2, SSO_CAPACITY2> &str, size_type start = 0) const noexcept -> std::optional<size_type> {
+				return this->m_find(str.getData(), str.getSize(), start);
+			}
+			constexpr auto find(const CharT *str, size_type start = 0) const noexcept -> std::optional<size_type> {
+				return this->m_find(str, std::char_traits<CharT>::length(str), start);
+			}
+			constexpr auto find(BasicStringView<CharT> str, size_type start = 0) const noexcept -> std::optional<size_type> {
+				return this->m_find(str.getData(), str.getSize(), start);
+			}
+			constexpr auto rfind(CharT value) const noexcept -> std::optional<size_type>;
+			template <sl::memory::IsAllocator Alloc2, std::size_t SSO_CAPACITY2>
+			constexpr auto rfind(const BasicString<CharT, Alloc2, SSO_CAPACITY2> &str) const noexcept -> std::optional<size_type> {return this->m_rfind(str.getData(), str.getSize());}
+			constexpr auto rfind(const CharT *str) const noexcept -> std::optional<size_type> {return this->m_rfind(str, std::char_traits<CharT>::length(str));}
+			constexpr auto rfind(BasicStringView<CharT> str) const noexcept -> std::optional<size_type> {return this->m_rfind(str.getData(), str.getSize());}
+
+			constexpr auto contains(CharT value) const noexcept -> bool {return this->find(value).has_value();}
+			template <sl::memory::IsAllocator Alloc2, std::size_t SSO_CAPACITY2>
+			constexpr auto contains(const BasicString<CharT, Alloc2, SSO_CAPACITY2> &str) const noexcept -> bool {return this->find(str).has_value();}
+			constexpr auto contains(const CharT *str) const noexcept -> bool {return this->find(str).has_value();}
+			constexpr auto contains(BasicStringView<CharT> str) const noexcept -> bool {return this->find(str).has_value();}
+
+			template <sl::memory::IsAllocator Alloc2, std::size_t SSO_CAPACITY2>
+			constexpr auto startsWith(const BasicString<CharT, Alloc2, SSO_CAPACITY2> &str) const noexcept -> bool {return this->m_startsWith(str.getData(), str.getSize());}
+			constexpr auto startsWith(const CharT *str) const noexcept -> bool {return this->m_startsWith(str, std::char_traits<CharT>::length(str));}
+			constexpr auto startsWith(BasicStringView<CharT> str) const noexcept -> bool {return this->m_startsWith(str.getData(), str.getSize());}
+			template <sl::memory::IsAllocator Alloc2, std::size_t SSO_CAPACITY2>
+			constexpr auto endsWith(const BasicString<CharT, Alloc2, SSO_CAPACITY2> &str) const noexcept -> bool {return this->m_endsWith(str.getData(), str.getSize());}
+			constexpr auto endsWith(const CharT *str) const noexcept -> bool {return this->m_endsWith(str, std::char_traits<CharT>::length(str));}
+			constexpr auto endsWith(BasicStringView<CharT> str) const noexcept -> bool {return this->m_endsWith(str.getData(), str.getSize());}
+
+			// The view is invalidated by any modification of the string
+			constexpr auto getView() const noexcept -> BasicStringView<CharT> {return BasicStringView<CharT> (this->getData(), this->getSize());}
+			constexpr auto getView(size_type start, size_type count = BasicStringView<CharT>::NPOS) const noexcept -> BasicStringView<CharT> {
+				return this->getView().subView(start, count);
+			}
+
 			constexpr auto at(difference_type index) noexcept -> iterator;
 			constexpr auto at(difference_type index) const noexcept -> const_iterator;
 
@@ -162,6 +236,22 @@ namespace sl::utils {
 
 		private:
 			constexpr auto m_isSSO() const noexcept -> bool;
+			// frees the heap buffer if any and leaves an empty SSO string. Used by the assignments instead of the destructor,
+			// as writing to the object after its destructor ran is undefined
+			constexpr auto m_release() noexcept -> void;
+			constexpr auto m_getBuffer() noexcept -> CharT*;
+			// grows the capacity by 1.5x steps until `newSize` fits, so that repeated insertions are amortized
+			constexpr auto m_grow(size_type newSize) noexcept -> void;
+			// number of characters out of `count` that can be inserted, which is only limited for inline strings
+			constexpr auto m_clampInsertion(size_type count) const noexcept -> size_type;
+			constexpr auto m_insert(difference_type position, const CharT *str, size_type size) noexcept -> iterator;
+			// same as m_insert at the end, without moving the tail
+			constexpr auto m_append(const CharT *str, size_type size) noexcept -> iterator;
+			constexpr auto m_compare(const CharT *str, size_type size) const noexcept -> std::strong_ordering;
+			constexpr auto m_find(const CharT *str, size_type size, size_type start) const noexcept -> std::optional<size_type>;
+			constexpr auto m_rfind(const CharT *str, size_type size) const noexcept -> std::optional<size_type>;
+			constexpr auto m_startsWith(const CharT *str, size_type size) const noexcept -> bool;
+			constexpr auto m_endsWith(const CharT *str, size_type size) const noexcept -> bool;
 			constexpr auto m_allocate(size_type size) noexcept -> pointer;
 			constexpr auto m_deallocate(pointer res, size_type size) noexcept -> void;
 			constexpr auto m_normalizeIndex(difference_type index, size_type size = 0) const noexcept -> difference_type;
@@ -189,26 +279,37 @@ namespace sl::utils {
 				size_type capacity;
 			};
 
+			static constexpr size_type MAX_SSO_CAPACITY {std::max<size_type> (SSO_CAPACITY, sizeof(Heap) / sizeof(CharT))};
+			static constexpr size_type MAX_SSO_SIZE {MAX_SSO_CAPACITY - 1};
+
 			struct SSO {
-				CharT buffer[sizeof(Heap) / sizeof(CharT)];
+				CharT buffer[MAX_SSO_CAPACITY];
 			};
 
 			union {
 				Heap m_heap;
 				SSO m_sso;
 			};
-
-			static constexpr size_type MAX_SSO_CAPACITY {sizeof(m_heap) / sizeof(CharT)};
-			static constexpr size_type MAX_SSO_SIZE {MAX_SSO_CAPACITY - 1};
 	};
 
 
+	/*
+	 * String of at most `CAPACITY - 1` characters that lives entirely inline and never allocates. The insertions that
+	 * don't fit are truncated
+	 */
+	template <std::size_t CAPACITY, typename CharT = char>
+	using BasicInlineString = BasicString<CharT, sl::memory::NullAllocator<CharT>, CAPACITY>;
+
+
 	static_assert(std::ranges::random_access_range<BasicString<char>>, "String type must fullfill std::ranges::random_access_range concept");
+	static_assert(sizeof(BasicString<char>) == sizeof(char*) + 2 * sizeof(std::size_t));
 
 	template <typename CharT>
 	constexpr auto getSize(const CharT *str) noexcept -> std::size_t {return std::strlen(str);}
-	template <typename CharT, typename Alloc>
-	constexpr auto getSize(const BasicString<CharT, Alloc> &str) noexcept -> BasicString<CharT, Alloc>::size_type {return str.getSize();}
+	template <typename CharT, typename Alloc, std::size_t SSO_CAPACITY>
+	constexpr auto getSize(const BasicString<CharT, Alloc, SSO_CAPACITY> &str) noexcept -> BasicString<CharT, Alloc, SSO_CAPACITY>::size_type {return str.getSize();}
+	template <typename CharT>
+	constexpr auto getSize(const BasicStringView<CharT> &str) noexcept -> std::size_t {return str.getSize();}
 
 
 	template <typename ...Types>
@@ -222,9 +323,9 @@ namespace sl::utils {
 			using Type = void;
 		};
 
-		template <typename CharT, sl::memory::IsAllocator Alloc, typename ...Args>
-		struct FirstStringFinder<std::tuple<sl::utils::BasicString<CharT, Alloc>, Args...>> {
-			using Type = sl::utils::BasicString<CharT, Alloc>;
+		template <typename CharT, sl::memory::IsAllocator Alloc, std::size_t SSO_CAPACITY, typename ...Args>
+		struct FirstStringFinder<std::tuple<sl::utils::BasicString<CharT, Alloc, SSO_CAPACITY>, Args...>> {
+			using Type = sl::utils::BasicString<CharT, Alloc, SSO_CAPACITY>;
 		};
 
 		template <typename T, typename ...Args>
@@ -304,30 +405,40 @@ namespace sl::utils {
 		return ConcatStringView<T, Types...> (lhs, csv);
 	}
 
-	template <typename CharT, sl::memory::IsAllocator Alloc>
-	constexpr auto operator+(const sl::utils::BasicString<CharT, Alloc> &str, const CharT *rhs) noexcept {
-		return ConcatStringView<sl::utils::BasicString<CharT, Alloc>, const CharT *> (str, rhs);
+	template <typename CharT, sl::memory::IsAllocator Alloc, std::size_t SSO_CAPACITY>
+	constexpr auto operator+(const sl::utils::BasicString<CharT, Alloc, SSO_CAPACITY> &str, const CharT *rhs) noexcept {
+		return ConcatStringView<sl::utils::BasicString<CharT, Alloc, SSO_CAPACITY>, const CharT *> (str, rhs);
+	}
+
+	template <typename CharT, sl::memory::IsAllocator Alloc, std::size_t SSO_CAPACITY>
+	constexpr auto operator+(const CharT *lhs, const sl::utils::BasicString<CharT, Alloc, SSO_CAPACITY> &str) noexcept {
+		return ConcatStringView<const CharT *, sl::utils::BasicString<CharT, Alloc, SSO_CAPACITY>> (lhs, str);
+	}
+
+	template <typename CharT, sl::memory::IsAllocator Alloc, std::size_t SSO_CAPACITY, sl::memory::IsAllocator Alloc2, std::size_t SSO_CAPACITY2>
+	constexpr auto operator+(const sl::utils::BasicString<CharT, Alloc, SSO_CAPACITY> &lhs, const sl::utils::BasicString<CharT, Alloc2, SSO_CAPACITY2> &rhs) noexcept {
+		return ConcatStringView<sl::utils::BasicString<CharT, Alloc, SSO_CAPACITY>, sl::utils::BasicString<CharT, Alloc2, SSO_CAPACITY2>> (lhs, rhs);
 	}
 
-	template <typename CharT, sl::memory::IsAllocator Alloc>
-	constexpr auto operator+(const CharT *lhs, const sl::utils::BasicString<CharT, Alloc> &str) noexcept {
-		return ConcatStringView<const CharT *, sl::utils::BasicString<CharT, Alloc>> (lhs, str);
+	template <typename CharT, sl::memory::IsAllocator Alloc, std::size_t SSO_CAPACITY>
+	constexpr auto operator+(const sl::utils::BasicString<CharT, Alloc, SSO_CAPACITY> &str, const sl::utils::BasicStringView<CharT> &rhs) noexcept {
+		return ConcatStringView<sl::utils::BasicString<CharT, Alloc, SSO_CAPACITY>, sl::utils::BasicStringView<CharT>> (str, rhs);
 	}
 
-	template <typename CharT, sl::memory::IsAllocator Alloc, sl::memory::IsAllocator Alloc2>
-	constexpr auto operator+(const sl::utils::BasicString<CharT, Alloc> &lhs, const sl::utils::BasicString<CharT, Alloc2> &rhs) noexcept {
-		return ConcatStringView<sl::utils::BasicString<CharT, Alloc>, sl::utils::BasicString<CharT, Alloc2>> (lhs, rhs);
+	template <typename CharT, sl::memory::IsAllocator Alloc, std::size_t SSO_CAPACITY>
+	constexpr auto operator+(const sl::utils::BasicStringView<CharT> &lhs, const sl::utils::BasicString<CharT, Alloc, SSO_CAPACITY> &str) noexcept {
+		return ConcatStringView<sl::utils::BasicStringView<CharT>, sl::utils::BasicString<CharT, Alloc, SSO_CAPACITY>> (lhs, str);
 	}
 
 
-	template <std::integral T, typename CharT, sl::memory::IsAllocator Alloc>
-	constexpr auto stringToNumber(const sl::utils::BasicString<CharT, Alloc> &string) noexcept -> std::optional<T>;
-	template <std::floating_point T, typename CharT, sl::memory::IsAllocator Alloc>
-	constexpr auto stringToNumber(const sl::utils::BasicString<CharT, Alloc> &string) noexcept -> std::optional<T>;
+	template <std::integral T, typename CharT, sl::memory::IsAllocator Alloc, std::size_t SSO_CAPACITY>
+	constexpr auto stringToNumber(const sl::utils::BasicString<CharT, Alloc, SSO_CAPACITY> &string) noexcept -> std::optional<T>;
+	template <std::floating_point T, typename CharT, sl::memory::IsAllocator Alloc, std::size_t SSO_CAPACITY>
+	constexpr auto stringToNumber(const sl::utils::BasicString<CharT, Alloc, SSO_CAPACITY> &string) noexcept -> std::optional<T>;
 
 	
-	template <typename CharT, sl::memory::IsAllocator Alloc>
-	inline auto operator<<(std::ostream &stream, const sl::utils::BasicString<CharT, Alloc> &str) noexcept -> std::ostream& {
+	template <typename CharT, sl::memory::IsAllocator Alloc, std::size_t SSO_CAPACITY>
+	inline auto operator<<(std::ostream &stream, const sl::utils::BasicString<CharT, Alloc, SSO_CAPACITY> &str) noexcept -> std::ostream& {
 		return stream << str.getData();
 	}
 
@@ -340,9 +451,9 @@ namespace sl::utils {
 } // namespace sl::utils
 
 
-template <typename CharT, sl::memory::IsAllocator Alloc>
-struct std::formatter<sl::utils::BasicString<CharT, Alloc>> : public std::formatter<const CharT*> {
-	auto format(const sl::utils::BasicString<CharT, Alloc> &str, std::format_context &ctx) const {
+template <typename CharT, sl::memory::IsAllocator Alloc, std::size_t SSO_CAPACITY>
+struct std::formatter<sl::utils::BasicString<CharT, Alloc, SSO_CAPACITY>> : public std::formatter<const CharT*> {
+	auto format(const sl::utils::BasicString<CharT, Alloc, SSO_CAPACITY> &str, std::format_context &ctx) const {
 		return std::formatter<const CharT*>::format(str.getData(), ctx);
 	}
 };
@@ -353,4 +464,6 @@ struct std::formatter<sl::utils::BasicString<CharT, Alloc>> : public std::format
 namespace sl {
 	using String = sl::utils::BasicString<char>;
 	using PMRString = sl::utils::BasicString<char, std::pmr::polymorphic_allocator<char>>;
+	template <std::size_t CAPACITY>
+	using InlineString = sl::utils::BasicInlineString<CAPACITY, char>;
 } // namespace sl
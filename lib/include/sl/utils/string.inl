@@ -3,137 +3,149 @@
 #include "sl/utils/string.hpp"
 
 #include <algorithm>
-#include <cmath>
 #include <cstring>
+#include <functional>
 #include <map>
 
 #include "sl/utils/memory.hpp"
+#include "sl/utils/stringSearch.hpp"
+#include "sl/utils/stringToNumber.hpp"
 
 
 namespace sl::utils {
-	template <typename CharT, sl::memory::IsAllocator Alloc>
-	constexpr BasicString<CharT, Alloc>::BasicString(const Alloc &alloc) noexcept :
-		m_content {s_createContent(alloc)},
-		m_sso {}
+	template <typename CharT, sl::memory::IsAllocator Alloc, std::size_t SSO_CAPACITY>
+	constexpr BasicString<CharT, Alloc, SSO_CAPACITY>::BasicString(const Alloc &alloc) noexcept :
+		m_content {s_createContent(alloc)}
 	{
+		// only the null-terminating character is needed for a valid empty string, the rest of the buffer stays untouched
+		m_sso.buffer[0] = static_cast<CharT> ('\0');
 		if constexpr (sl::memory::IsAllocatorStatefull_v<Alloc>) {
 			m_content.allocator.~Alloc();
 			new(&m_content.allocator) Alloc(alloc);
 		}
-		sl::utils::memset<CharT> (m_sso.buffer, static_cast<CharT> ('\0'), MAX_SSO_CAPACITY);
 	}
 
 
-	template <typename CharT, sl::memory::IsAllocator Alloc>
-	constexpr BasicString<CharT, Alloc>::BasicString(const CharT *str, const Alloc &alloc) noexcept :
-		BasicString<CharT, Alloc> (alloc)
+	template <typename CharT, sl::memory::IsAllocator Alloc, std::size_t SSO_CAPACITY>
+	constexpr BasicString<CharT, Alloc, SSO_CAPACITY>::BasicString(const CharT *str, const Alloc &alloc) noexcept :
+		BasicString<CharT, Alloc, SSO_CAPACITY> (alloc)
 	{
-		for (const CharT *current {str}; *current != static_cast<CharT> ('\0'); ++current) ++m_content.size;
+		size_type size {0};
+		for (const CharT *current {str}; *current != static_cast<CharT> ('\0'); ++current) ++size;
+		m_content.size = this->m_clampInsertion(size);
 		if (m_content.size <= MAX_SSO_SIZE) {
-			(void)sl::utils::memcpy<CharT> (m_sso.buffer, str, m_content.size + 1);
+			(void)sl::utils::memcpy<CharT> (m_sso.buffer, str, m_content.size);
+			m_sso.buffer[m_content.size] = static_cast<CharT> ('\0');
 			return;
 		}
 
-		m_content.size.template setFlag<0> (true);
-		m_heap.capacity = m_content.size + 1;
-		m_heap.start = this->m_allocate(m_heap.capacity);
-		(void)sl::utils::memcpy<CharT> (&*m_heap.start, str, m_heap.capacity);
+		if constexpr (!IS_INLINE) {
+			m_content.size.template setFlag<0> (true);
+			m_heap.capacity = m_content.size + 1;
+			m_heap.start = this->m_allocate(m_heap.capacity);
+			(void)sl::utils::memcpy<CharT> (&*m_heap.start, str, m_content.size);
+			m_heap.start[m_content.size] = static_cast<CharT> ('\0');
+		}
 	}
 
 
-	template <typename CharT, sl::memory::IsAllocator Alloc>
-	constexpr BasicString<CharT, Alloc>::BasicString(const CharT *str, size_type size, const Alloc &alloc) noexcept :
-		BasicString<CharT, Alloc> (alloc)
+	template <typename CharT, sl::memory::IsAllocator Alloc, std::size_t SSO_CAPACITY>
+	constexpr BasicString<CharT, Alloc, SSO_CAPACITY>::BasicString(const CharT *str, size_type size, const Alloc &alloc) noexcept :
+		BasicString<CharT, Alloc, SSO_CAPACITY> (alloc)
 	{
-		m_content.size = size;
+		m_content.size = this->m_clampInsertion(size);
 		if (m_content.size <= MAX_SSO_SIZE) {
 			(void)sl::utils::memcpy<CharT> (m_sso.buffer, str, m_content.size);
 			m_sso.buffer[m_content.size] = static_cast<CharT> ('\0');
 			return;
 		}
 
-		m_content.size.template setFlag<0> (true);
-		m_heap.capacity = m_content.size + 1;
-		m_heap.start = this->m_allocate(m_heap.capacity);
-		(void)sl::utils::memcpy<CharT> (&*m_heap.start, str, m_content.size);
-		m_heap.start[m_content.size] = static_cast<CharT> ('\0');
+		if constexpr (!IS_INLINE) {
+			m_content.size.template setFlag<0> (true);
+			m_heap.capacity = m_content.size + 1;
+			m_heap.start = this->m_allocate(m_heap.capacity);
+			(void)sl::utils::memcpy<CharT> (&*m_heap.start, str, m_content.size);
+			m_heap.start[m_content.size] = static_cast<CharT> ('\0');
+		}
 	}
 
 
-	template<typename CharT, sl::memory::IsAllocator Alloc>
-	constexpr BasicString<CharT, Alloc>::~BasicString() {
-		if (this->m_isSSO()) {
-			m_content.size = 0;
-			(void)sl::utils::memset<CharT> (m_sso.buffer, static_cast<CharT> ('\0'), MAX_SSO_CAPACITY);
-			return;
+	template <typename CharT, sl::memory::IsAllocator Alloc, std::size_t SSO_CAPACITY>
+	constexpr BasicString<CharT, Alloc, SSO_CAPACITY>::~BasicString() {
+		if constexpr (!IS_INLINE) {
+			if (!this->m_isSSO())
+				this->m_deallocate(m_heap.start, m_heap.capacity);
 		}
-		this->m_deallocate(m_heap.start, m_heap.capacity);
-		m_content.size = 0;
-		m_content.size.template setFlag<0> (false);
-		m_heap.start = nullptr;
-		m_heap.capacity = 0;
 	}
 
 
-	template <typename CharT, sl::memory::IsAllocator Alloc>
-	constexpr BasicString<CharT, Alloc>::BasicString(const BasicString<CharT, Alloc> &str) noexcept :
-		BasicString<CharT, Alloc> (std::allocator_traits<Alloc>::select_on_container_copy_construction(str.m_copyAllocator()))
+	template <typename CharT, sl::memory::IsAllocator Alloc, std::size_t SSO_CAPACITY>
+	constexpr BasicString<CharT, Alloc, SSO_CAPACITY>::BasicString(const BasicString<CharT, Alloc, SSO_CAPACITY> &str) noexcept :
+		BasicString<CharT, Alloc, SSO_CAPACITY> (std::allocator_traits<Alloc>::select_on_container_copy_construction(str.m_copyAllocator()))
 	{
 		m_content.size = str.m_content.size;
 
 		if (this->m_isSSO()) {
-			(void)sl::utils::memcpy<CharT> (m_sso.buffer, str.m_sso.buffer, MAX_SSO_CAPACITY);
+			(void)sl::utils::memcpy<CharT> (m_sso.buffer, str.m_sso.buffer, m_content.size + 1);
 			return;
 		}
 
-		m_heap.capacity = m_content.size + 1;
-		m_heap.start = this->m_allocate(m_heap.capacity);
-		(void)sl::utils::memcpy<CharT> (&*m_heap.start, &*str.m_heap.start, m_heap.capacity);
+		if constexpr (!IS_INLINE) {
+			m_heap.capacity = m_content.size + 1;
+			m_heap.start = this->m_allocate(m_heap.capacity);
+			(void)sl::utils::memcpy<CharT> (&*m_heap.start, &*str.m_heap.start, m_heap.capacity);
+		}
 	}
 
 
-	template <typename CharT, sl::memory::IsAllocator Alloc>
-	constexpr BasicString<CharT, Alloc> &BasicString<CharT, Alloc>::operator=(const BasicString<CharT, Alloc> &str) noexcept {
-		this->~BasicString<CharT, Alloc> ();
+	template <typename CharT, sl::memory::IsAllocator Alloc, std::size_t SSO_CAPACITY>
+	constexpr BasicString<CharT, Alloc, SSO_CAPACITY> &BasicString<CharT, Alloc, SSO_CAPACITY>::operator=(const BasicString<CharT, Alloc, SSO_CAPACITY> &str) noexcept {
+		if (this == &str)
+			return *this;
+		this->m_release();
 
 		m_content.size = str.m_content.size;
 		if constexpr (sl::memory::IsAllocatorStatefull_v<Alloc>)
 			m_content.allocator = std::allocator_traits<Alloc>::select_on_container_copy_construction(str.m_content.allocator);
 
 		if (this->m_isSSO()) {
-			(void)sl::utils::memcpy<CharT> (m_sso.buffer, str.m_sso.buffer, MAX_SSO_CAPACITY);
+			(void)sl::utils::memcpy<CharT> (m_sso.buffer, str.m_sso.buffer, m_content.size + 1);
 			return *this;
 		}
 
-		m_heap.capacity = m_content.size + 1;
-		m_heap.start = this->m_allocate(m_heap.capacity);
-		(void)sl::utils::memcpy<CharT> (&*m_heap.start, &*str.m_heap.start, m_heap.capacity);
+		if constexpr (!IS_INLINE) {
+			m_heap.capacity = m_content.size + 1;
+			m_heap.start = this->m_allocate(m_heap.capacity);
+			(void)sl::utils::memcpy<CharT> (&*m_heap.start, &*str.m_heap.start, m_heap.capacity);
+		}
 		return *this;
 	}
 
 
-	template <typename CharT, sl::memory::IsAllocator Alloc>
-	constexpr BasicString<CharT, Alloc>::BasicString(BasicString<CharT, Alloc> &&str) noexcept :
-		BasicString<CharT, Alloc> (std::move(str.m_copyAllocator()))
+	template <typename CharT, sl::memory::IsAllocator Alloc, std::size_t SSO_CAPACITY>
+	constexpr BasicString<CharT, Alloc, SSO_CAPACITY>::BasicString(BasicString<CharT, Alloc, SSO_CAPACITY> &&str) noexcept :
+		BasicString<CharT, Alloc, SSO_CAPACITY> (std::move(str.m_copyAllocator()))
 	{
 		m_content.size = str.m_content.size;
 		str.m_content.size = 0;
 		str.m_content.size.template setFlag<0> (false);
 
 		if (this->m_isSSO())
-			(void)sl::utils::memcpy<CharT> (m_sso.buffer, str.m_sso.buffer, MAX_SSO_CAPACITY);
-		else {
+			(void)sl::utils::memcpy<CharT> (m_sso.buffer, str.m_sso.buffer, m_content.size + 1);
+		else if constexpr (!IS_INLINE) {
 			m_heap.capacity = str.m_heap.capacity;
 			m_heap.start = str.m_heap.start;
 		}
 
-		(void)sl::utils::memset<CharT> (str.m_sso.buffer, static_cast<CharT> ('\0'), MAX_SSO_CAPACITY);
+		str.m_sso.buffer[0] = static_cast<CharT> ('\0');
 	}
 
 
-	template <typename CharT, sl::memory::IsAllocator Alloc>
-	constexpr BasicString<CharT, Alloc> &BasicString<CharT, Alloc>::operator=(BasicString<CharT, Alloc> &&str) noexcept {
-		this->~BasicString<CharT, Alloc> ();
+	template <typename CharT, sl::memory::IsAllocator Alloc, std::size_t SSO_CAPACITY>
+	constexpr BasicString<CharT, Alloc, SSO_CAPACITY> &BasicString<CharT, Alloc, SSO_CAPACITY>::operator=(BasicString<CharT, Alloc, SSO_CAPACITY> &&str) noexcept {
+		if (this == &str)
+			return *this;
+		this->m_release();
 
 		m_content.size = str.m_content.size;
 		str.m_content.size = 0;
@@ -142,37 +154,43 @@ namespace sl::utils {
 			m_content.allocator = std::move(str.m_content.allocator);
 
 		if (this->m_isSSO())
-			(void)sl::utils::memcpy<CharT> (m_sso.buffer, str.m_sso.buffer, MAX_SSO_CAPACITY);
-		else {
+			(void)sl::utils::memcpy<CharT> (m_sso.buffer, str.m_sso.buffer, m_content.size + 1);
+		else if constexpr (!IS_INLINE) {
 			m_heap.capacity = str.m_heap.capacity;
 			m_heap.start = str.m_heap.start;
 		}
 
-		(void)sl::utils::memset<CharT> (str.m_sso.buffer, static_cast<CharT> ('\0'), MAX_SSO_CAPACITY);
+		str.m_sso.buffer[0] = static_cast<CharT> ('\0');
 		return *this;
 	}
 
 
-	template <typename CharT, sl::memory::IsAllocator Alloc>
-	constexpr const auto &__BasicString_dereference(const sl::utils::BasicString<CharT, Alloc> *ptr) noexcept {return *ptr;}
+	template <typename CharT, sl::memory::IsAllocator Alloc, std::size_t SSO_CAPACITY>
+	constexpr const auto &__BasicString_dereference(const sl::utils::BasicString<CharT, Alloc, SSO_CAPACITY> *ptr) noexcept {return *ptr;}
+	template <typename CharT>
+	constexpr const auto &__BasicString_dereference(const sl::utils::BasicStringView<CharT> *ptr) noexcept {return *ptr;}
 	template <typename CharT>
 	constexpr CharT *__BasicString_dereference(CharT *value) noexcept {return value;}
 
-	template <typename CharT, sl::memory::IsAllocator Alloc>
-	constexpr auto __BasicString_begin(const sl::utils::BasicString<CharT, Alloc> &str) noexcept {return std::begin(str);}
+	template <typename CharT, sl::memory::IsAllocator Alloc, std::size_t SSO_CAPACITY>
+	constexpr auto __BasicString_begin(const sl::utils::BasicString<CharT, Alloc, SSO_CAPACITY> &str) noexcept {return std::begin(str);}
+	template <typename CharT>
+	constexpr auto __BasicString_begin(const sl::utils::BasicStringView<CharT> &str) noexcept {return str.begin();}
 	template <typename CharT>
 	constexpr auto __BasicString_begin(CharT *value) noexcept {return value;}
-	template <typename CharT, sl::memory::IsAllocator Alloc>
-	constexpr auto __BasicString_end(const sl::utils::BasicString<CharT, Alloc> &str) noexcept {return std::end(str);}
+	template <typename CharT, sl::memory::IsAllocator Alloc, std::size_t SSO_CAPACITY>
+	constexpr auto __BasicString_end(const sl::utils::BasicString<CharT, Alloc, SSO_CAPACITY> &str) noexcept {return std::end(str);}
+	template <typename CharT>
+	constexpr auto __BasicString_end(const sl::utils::BasicStringView<CharT> &str) noexcept {return str.end();}
 	template <typename CharT>
 	constexpr auto __BasicString_end(CharT *value) noexcept {return value + sl::utils::getSize(value);}
 
 
-	template <typename CharT, sl::memory::IsAllocator Alloc>
+	template <typename CharT, sl::memory::IsAllocator Alloc, std::size_t SSO_CAPACITY>
 	template <typename ...Types>
 	requires std::same_as<Alloc, typename ConcatStringView<Types...>::Allocator>
-	constexpr BasicString<CharT, Alloc>::BasicString(const ConcatStringView<Types...> &csv) noexcept :
-		BasicString<CharT, Alloc> ()
+	constexpr BasicString<CharT, Alloc, SSO_CAPACITY>::BasicString(const ConcatStringView<Types...> &csv) noexcept :
+		BasicString<CharT, Alloc, SSO_CAPACITY> ()
 	{
 		size_type size {};
 		std::apply([&size](auto &&...args) noexcept {
@@ -187,11 +205,11 @@ namespace sl::utils {
 	}
 
 
-	template <typename CharT, sl::memory::IsAllocator Alloc>
+	template <typename CharT, sl::memory::IsAllocator Alloc, std::size_t SSO_CAPACITY>
 	template <typename ...Types>
 	requires std::same_as<Alloc, typename ConcatStringView<Types...>::Allocator>
-	constexpr BasicString<CharT, Alloc> &BasicString<CharT, Alloc>::operator=(const ConcatStringView<Types...> &csv) noexcept {
-		this->~BasicString<CharT, Alloc> ();
+	constexpr BasicString<CharT, Alloc, SSO_CAPACITY> &BasicString<CharT, Alloc, SSO_CAPACITY>::operator=(const ConcatStringView<Types...> &csv) noexcept {
+		this->m_release();
 
 		size_type size {};
 		std::apply([&size](auto &&...args) noexcept {
@@ -208,169 +226,136 @@ namespace sl::utils {
 	}
 
 
-	template <typename CharT, sl::memory::IsAllocator Alloc>
-	template <sl::memory::IsAllocator Alloc2>
-	constexpr auto BasicString<CharT, Alloc>::operator==(const BasicString<CharT, Alloc2> &str) const noexcept -> bool {
+	template <typename CharT, sl::memory::IsAllocator Alloc, std::size_t SSO_CAPACITY>
+	template <sl::memory::IsAllocator Alloc2, std::size_t SSO_CAPACITY2>
+	constexpr auto BasicString<CharT, Alloc, SSO_CAPACITY>::operator==(const BasicString<CharT, Alloc2, SSO_CAPACITY2> &str) const noexcept -> bool {
 		if (m_content.size != str.getSize())
 			return false;
-
-		for (size_type i {0}; i < m_content.size; ++i) {
-			if ((*this)[i] != str[i])
-				return false;
-		}
-		return true;
+		return sl::utils::compare(this->getData(), str.getData(), m_content.size) == 0;
 	}
 
 
-	template <typename CharT, sl::memory::IsAllocator Alloc>
-	constexpr auto BasicString<CharT, Alloc>::operator==(const CharT *str) const noexcept -> bool {
-		for (size_type i {0}; i < m_content.size; ++i) {
-			if ((*this)[i] != str[i])
-				return false;
-		}
-		return true;
+	template <typename CharT, sl::memory::IsAllocator Alloc, std::size_t SSO_CAPACITY>
+	constexpr auto BasicString<CharT, Alloc, SSO_CAPACITY>::operator==(const CharT *str) const noexcept -> bool {
+		if (m_content.size != std::char_traits<CharT>::length(str))
+			return false;
+		return sl::utils::compare(this->getData(), str, m_content.size) == 0;
 	}
 
 
-	template <typename CharT, sl::memory::IsAllocator Alloc>
+	template <typename CharT, sl::memory::IsAllocator Alloc, std::size_t SSO_CAPACITY>
 	template <typename ...Types>
-	constexpr auto BasicString<CharT, Alloc>::operator==(const ConcatStringView<Types...> &csv) const noexcept -> bool {
-		return *this == BasicString<CharT, typename ConcatStringView<Types...>::Allocator> (csv);
+	constexpr auto BasicString<CharT, Alloc, SSO_CAPACITY>::operator==(const ConcatStringView<Types...> &csv) const noexcept -> bool {
+		return *this == typename ConcatStringView<Types...>::FirstString (csv);
 	}
 
 
-	template <typename CharT, sl::memory::IsAllocator Alloc>
-	constexpr BasicString<CharT, Alloc>::size_type BasicString<CharT, Alloc>::reserve(size_type newSize) noexcept {
+	template <typename CharT, sl::memory::IsAllocator Alloc, std::size_t SSO_CAPACITY>
+	constexpr BasicString<CharT, Alloc, SSO_CAPACITY>::size_type BasicString<CharT, Alloc, SSO_CAPACITY>::reserve(size_type newSize) noexcept {
 		size_type capacity {this->getCapacity()};
-		if (newSize < capacity)
+		if constexpr (IS_INLINE)
 			return capacity - 1;
-		
-		size_type newCapacity {newSize + 1};
-		pointer buffer {this->m_allocate(newCapacity)};
-		if (this->m_isSSO())
-			(void)sl::utils::memcpy<CharT> (buffer, m_sso.buffer, capacity);
 		else {
-			(void)sl::utils::memmove<CharT> (buffer, m_heap.start, newCapacity);
-			this->m_deallocate(m_heap.start, m_heap.capacity);
-		}
+			if (newSize < capacity)
+				return capacity - 1;
+
+			size_type newCapacity {newSize + 1};
+			pointer buffer {this->m_allocate(newCapacity)};
+			if (this->m_isSSO())
+				(void)sl::utils::memcpy<CharT> (buffer, m_sso.buffer, m_content.size + 1);
+			else {
+				(void)sl::utils::memcpy<CharT> (buffer, m_heap.start, m_content.size + 1);
+				this->m_deallocate(m_heap.start, m_heap.capacity);
+			}
 
-		m_heap.capacity = newCapacity;
-		m_heap.start = buffer;
-		m_content.size.template setFlag<0> (true);
-		return newCapacity - 1;
+			m_heap.capacity = newCapacity;
+			m_heap.start = buffer;
+			m_content.size.template setFlag<0> (true);
+			return newCapacity - 1;
+		}
 	}
 
 
-	template <typename CharT, sl::memory::IsAllocator Alloc>
-	constexpr BasicString<CharT, Alloc>::size_type BasicString<CharT, Alloc>::shrinkToFit() noexcept {
-		if (m_content.size <= MAX_SSO_SIZE) {
-			if (this->m_isSSO())
+	template <typename CharT, sl::memory::IsAllocator Alloc, std::size_t SSO_CAPACITY>
+	constexpr BasicString<CharT, Alloc, SSO_CAPACITY>::size_type BasicString<CharT, Alloc, SSO_CAPACITY>::shrinkToFit() noexcept {
+		if constexpr (IS_INLINE)
+			return MAX_SSO_SIZE;
+		else {
+			if (m_content.size <= MAX_SSO_SIZE) {
+				if (this->m_isSSO())
+					return MAX_SSO_SIZE;
+
+				pointer buffer {m_heap.start};
+				size_type capacity {m_heap.capacity};
+				(void)sl::utils::memcpy<CharT> (m_sso.buffer, m_heap.start, m_content.size + 1);
+				this->m_deallocate(buffer, capacity);
+				m_content.size.template setFlag<0> (false);
 				return MAX_SSO_SIZE;
+			}
 
-			pointer buffer {m_heap.start};
-			size_type capacity {m_heap.capacity};
-			(void)sl::utils::memcpy<CharT> (m_sso.buffer, m_heap.start, m_content.size + 1);
-			this->m_deallocate(buffer, capacity);
-			m_content.size.template setFlag<0> (false);
-			return MAX_SSO_SIZE;
-		}
+			if (m_heap.capacity == m_content.size + 1)
+				return m_content.size;
 
-		if (m_heap.capacity == m_content.size + 1)
+			pointer buffer {this->m_allocate(m_content.size + 1)};
+			(void)sl::utils::memcpy<CharT> (buffer, m_heap.start, m_content.size + 1);
+			this->m_deallocate(m_heap.start, m_heap.capacity);
+			m_heap.start = buffer;
+			m_heap.capacity = m_content.size + 1;
 			return m_content.size;
-
-		pointer buffer {this->m_allocate(m_content.size + 1)};
-		(void)sl::utils::memcpy<CharT> (buffer, m_heap.start, m_content.size + 1);
-		this->m_deallocate(m_heap.start, m_heap.capacity);
-		m_heap.start = buffer;
-		m_heap.capacity = m_content.size + 1;
-		return m_content.size;
+		}
 	}
 
 
-	template <typename CharT, sl::memory::IsAllocator Alloc>
-	constexpr BasicString<CharT, Alloc>::iterator BasicString<CharT, Alloc>::insert(difference_type position, CharT value, size_type count) noexcept {
+	template <typename CharT, sl::memory::IsAllocator Alloc, std::size_t SSO_CAPACITY>
+	constexpr BasicString<CharT, Alloc, SSO_CAPACITY>::iterator BasicString<CharT, Alloc, SSO_CAPACITY>::insert(difference_type position, CharT value, size_type count) noexcept {
 		position = this->m_normalizeIndex(position, m_content.size + 1);
-		size_type targetCapacity {m_content.size + count + 1};
-		if (this->getCapacity() < targetCapacity) {
-			constexpr long double CAPACITY_INCREASE_FACTOR {1.5};
-			size_type newCapacity {this->getCapacity()};
-			while (newCapacity < targetCapacity)
-				newCapacity *= CAPACITY_INCREASE_FACTOR;
-			(void)this->reserve(newCapacity - 1);
-		}
+		count = this->m_clampInsertion(count);
+		this->m_grow(m_content.size + count);
 
-		if (this->m_isSSO()) {
-			(void)sl::utils::memmove<CharT> (m_sso.buffer + position + count, m_sso.buffer + position, m_content.size - position + 1);
-			for (size_type i {0}; i < count; ++i)
-				m_sso.buffer[position + i] = value;
-			m_content.size += count;
-			return this->begin() + position;
-		}
+		CharT *buffer {this->m_getBuffer()};
+		if (static_cast<size_type> (position) != m_content.size)
+			(void)sl::utils::memmove<CharT> (buffer + position + count, buffer + position, m_content.size - position + 1);
+		else
+			buffer[m_content.size + count] = static_cast<CharT> ('\0');
 
-		(void)sl::utils::memmove<CharT> (m_heap.start + position + count, m_heap.start + position, m_content.size - position + 1);
 		for (size_type i {0}; i < count; ++i)
-			m_heap.start[position + i] = value;
+			buffer[position + i] = value;
 		m_content.size += count;
 		return this->begin() + position;
 	}
 
 
-	template <typename CharT, sl::memory::IsAllocator Alloc>
-	template <sl::memory::IsAllocator Alloc2>
-	constexpr BasicString<CharT, Alloc>::iterator BasicString<CharT, Alloc>::insert(difference_type position, const sl::utils::BasicString<CharT, Alloc2> &str) noexcept {
-		position = this->m_normalizeIndex(position, m_content.size + 1);
-		(void)this->reserve(m_content.size + str.m_content.size);
-
-		if (this->m_isSSO()) {
-			(void)sl::utils::memmove<CharT> (m_sso.buffer + position + str.m_content.size, m_sso.buffer + position, m_content.size - position + 1);
-			(void)sl::utils::memmove<CharT> (m_sso.buffer + position, str.m_sso.buffer, str.m_content.size);
-			m_content.size += str.m_content.size;
-			return this->begin() + position;
-		}
-
-		(void)sl::utils::memmove<CharT> (m_heap.start + position + str.m_content.size, m_heap.start + position, m_content.size - position + 1);
-		if (str.m_isSSO())
-			(void)sl::utils::memmove<CharT> (m_heap.start + position, str.m_sso.buffer, str.m_content.size);
-		else
-			(void)sl::utils::memmove<CharT> (m_heap.start + position, str.m_heap.start, str.m_content.size);
-
-		m_content.size += str.m_content.size;
-		return this->begin() + position;
+	template <typename CharT, sl::memory::IsAllocator Alloc, std::size_t SSO_CAPACITY>
+	template <sl::memory::IsAllocator Alloc2, std::size_t SSO_CAPACITY2>
+	constexpr BasicString<CharT, Alloc, SSO_CAPACITY>::iterator BasicString<CharT, Alloc, SSO_CAPACITY>::insert(difference_type position, const sl::utils::BasicString<CharT, Alloc2, SSO_CAPACITY2> &str) noexcept {
+		return this->m_insert(position, str.getData(), str.getSize());
 	}
 
 
-	template <typename CharT, sl::memory::IsAllocator Alloc>
+	template <typename CharT, sl::memory::IsAllocator Alloc, std::size_t SSO_CAPACITY>
 	template <std::forward_iterator IT>
 	requires std::convertible_to<typename std::iterator_traits<IT>::value_type, CharT>
-	constexpr BasicString<CharT, Alloc>::iterator BasicString<CharT, Alloc>::insert(difference_type position, const IT &start, const IT &end) noexcept {
-		size_type rangeSize {static_cast<size_type> (std::distance(start, end))};
+	constexpr BasicString<CharT, Alloc, SSO_CAPACITY>::iterator BasicString<CharT, Alloc, SSO_CAPACITY>::insert(difference_type position, const IT &start, const IT &end) noexcept {
+		size_type rangeSize {this->m_clampInsertion(static_cast<size_type> (std::distance(start, end)))};
 		position = this->m_normalizeIndex(position, m_content.size + 1);
-		(void)this->reserve(m_content.size + rangeSize);
+		this->m_grow(m_content.size + rangeSize);
 
-		if (this->m_isSSO()) {
-			(void)sl::utils::memmove<CharT> (m_sso.buffer + position + rangeSize, m_sso.buffer + position, m_content.size - position + 1);
-			size_type i {0};
-			for (IT it {start}; it != end; ++it) {
-				(m_sso.buffer + position)[i] = static_cast<CharT> (*it);
-				++i;
-			}
-			m_content.size += rangeSize;
-			return this->begin() + position;
-		}
+		CharT *buffer {this->m_getBuffer()};
+		if (static_cast<size_type> (position) != m_content.size)
+			(void)sl::utils::memmove<CharT> (buffer + position + rangeSize, buffer + position, m_content.size - position + 1);
+		else
+			buffer[m_content.size + rangeSize] = static_cast<CharT> ('\0');
 
-		(void)sl::utils::memmove<CharT> (m_heap.start + position + rangeSize, m_heap.start + position, m_content.size - position + 1);
-		size_type i {0};
-		for (IT it {start}; it != end; ++it) {
-			(m_heap.start + position)[i] = static_cast<CharT> (*it);
-			++i;
-		}
+		IT it {start};
+		for (size_type i {0}; i < rangeSize; ++i, ++it)
+			(buffer + position)[i] = static_cast<CharT> (*it);
 		m_content.size += rangeSize;
 		return this->begin() + position;
 	}
 
 
-	template <typename CharT, sl::memory::IsAllocator Alloc>
-	constexpr BasicString<CharT, Alloc>::iterator BasicString<CharT, Alloc>::erase(difference_type position, size_type count) noexcept {
+	template <typename CharT, sl::memory::IsAllocator Alloc, std::size_t SSO_CAPACITY>
+	constexpr BasicString<CharT, Alloc, SSO_CAPACITY>::iterator BasicString<CharT, Alloc, SSO_CAPACITY>::erase(difference_type position, size_type count) noexcept {
 		position = this->m_normalizeIndex(position);
 		if (count > m_content.size)
 			count = m_content.size;
@@ -385,114 +370,267 @@ namespace sl::utils {
 	}
 
 
-	template <typename CharT, sl::memory::IsAllocator Alloc>
-	constexpr BasicString<CharT, Alloc>::iterator BasicString<CharT, Alloc>::at(difference_type index) noexcept {
+	template <typename CharT, sl::memory::IsAllocator Alloc, std::size_t SSO_CAPACITY>
+	constexpr auto BasicString<CharT, Alloc, SSO_CAPACITY>::find(CharT value, size_type start) const noexcept -> std::optional<size_type> {
+		if (start >= m_content.size)
+			return std::nullopt;
+		const CharT *data {this->getData()};
+		const CharT *result {sl::utils::findChar(data + start, m_content.size - start, value)};
+		if (result == nullptr)
+			return std::nullopt;
+		return static_cast<size_type> (result - data);
+	}
+
+
+	template <typename CharT, sl::memory::IsAllocator Alloc, std::size_t SSO_CAPACITY>
+	constexpr auto BasicString<CharT, Alloc, SSO_CAPACITY>::rfind(CharT value) const noexcept -> std::optional<size_type> {
+		const CharT *data {this->getData()};
+		const CharT *result {sl::utils::findLastChar(data, m_content.size, value)};
+		if (result == nullptr)
+			return std::nullopt;
+		return static_cast<size_type> (result - data);
+	}
+
+
+	template <typename CharT, sl::memory::IsAllocator Alloc, std::size_t SSO_CAPACITY>
+	constexpr BasicString<CharT, Alloc, SSO_CAPACITY>::iterator BasicString<CharT, Alloc, SSO_CAPACITY>::at(difference_type index) noexcept {
 		index = this->m_normalizeIndex(index);
 		return this->begin() + index;
 	}
 
 
-	template <typename CharT, sl::memory::IsAllocator Alloc>
-	constexpr BasicString<CharT, Alloc>::const_iterator BasicString<CharT, Alloc>::at(difference_type index) const noexcept {
+	template <typename CharT, sl::memory::IsAllocator Alloc, std::size_t SSO_CAPACITY>
+	constexpr BasicString<CharT, Alloc, SSO_CAPACITY>::const_iterator BasicString<CharT, Alloc, SSO_CAPACITY>::at(difference_type index) const noexcept {
 		index = this->m_normalizeIndex(index);
 		return this->begin() + index;
 	}
 
 
-	template <typename CharT, sl::memory::IsAllocator Alloc>
-	constexpr BasicString<CharT, Alloc>::iterator BasicString<CharT, Alloc>::begin() noexcept {
+	template <typename CharT, sl::memory::IsAllocator Alloc, std::size_t SSO_CAPACITY>
+	constexpr BasicString<CharT, Alloc, SSO_CAPACITY>::iterator BasicString<CharT, Alloc, SSO_CAPACITY>::begin() noexcept {
 		if (this->m_isSSO())
 			return iterator(this, this->m_sso.buffer);
 		return iterator(this, this->m_heap.start);
 	}
 
 
-	template <typename CharT, sl::memory::IsAllocator Alloc>
-	constexpr BasicString<CharT, Alloc>::iterator BasicString<CharT, Alloc>::end() noexcept {
+	template <typename CharT, sl::memory::IsAllocator Alloc, std::size_t SSO_CAPACITY>
+	constexpr BasicString<CharT, Alloc, SSO_CAPACITY>::iterator BasicString<CharT, Alloc, SSO_CAPACITY>::end() noexcept {
 		if (this->m_isSSO())
 			return iterator(this, this->m_sso.buffer + m_content.size);
 		return iterator(this, this->m_heap.start + m_content.size);
 	}
 
 
-	template <typename CharT, sl::memory::IsAllocator Alloc>
-	constexpr BasicString<CharT, Alloc>::const_iterator BasicString<CharT, Alloc>::cbegin() const noexcept {
+	template <typename CharT, sl::memory::IsAllocator Alloc, std::size_t SSO_CAPACITY>
+	constexpr BasicString<CharT, Alloc, SSO_CAPACITY>::const_iterator BasicString<CharT, Alloc, SSO_CAPACITY>::cbegin() const noexcept {
 		if (this->m_isSSO())
 			return const_iterator(this, this->m_sso.buffer);
 		return const_iterator(this, this->m_heap.start);
 	}
 
 
-	template <typename CharT, sl::memory::IsAllocator Alloc>
-	constexpr BasicString<CharT, Alloc>::const_iterator BasicString<CharT, Alloc>::cend() const noexcept {
+	template <typename CharT, sl::memory::IsAllocator Alloc, std::size_t SSO_CAPACITY>
+	constexpr BasicString<CharT, Alloc, SSO_CAPACITY>::const_iterator BasicString<CharT, Alloc, SSO_CAPACITY>::cend() const noexcept {
 		if (this->m_isSSO())
 			return const_iterator(this, this->m_sso.buffer + m_content.size);
 		return const_iterator(this, this->m_heap.start + m_content.size);
 	}
 
 
-	template <typename CharT, sl::memory::IsAllocator Alloc>
-	constexpr BasicString<CharT, Alloc>::reverse_iterator BasicString<CharT, Alloc>::rbegin() noexcept {
+	template <typename CharT, sl::memory::IsAllocator Alloc, std::size_t SSO_CAPACITY>
+	constexpr BasicString<CharT, Alloc, SSO_CAPACITY>::reverse_iterator BasicString<CharT, Alloc, SSO_CAPACITY>::rbegin() noexcept {
 		if (this->m_isSSO())
 			return reverse_iterator(this, this->m_sso.buffer + m_content.size - 1);
 		return reverse_iterator(this, this->m_heap.start + m_content.size - 1);
 	}
 
 
-	template <typename CharT, sl::memory::IsAllocator Alloc>
-	constexpr BasicString<CharT, Alloc>::reverse_iterator BasicString<CharT, Alloc>::rend() noexcept {
+	template <typename CharT, sl::memory::IsAllocator Alloc, std::size_t SSO_CAPACITY>
+	constexpr BasicString<CharT, Alloc, SSO_CAPACITY>::reverse_iterator BasicString<CharT, Alloc, SSO_CAPACITY>::rend() noexcept {
 		if (this->m_isSSO())
 			return reverse_iterator(this, this->m_sso.buffer - 1);
 		return reverse_iterator(this, this->m_heap.start - 1);
 	}
 
 
-	template <typename CharT, sl::memory::IsAllocator Alloc>
-	constexpr BasicString<CharT, Alloc>::const_reverse_iterator BasicString<CharT, Alloc>::crbegin() const noexcept {
+	template <typename CharT, sl::memory::IsAllocator Alloc, std::size_t SSO_CAPACITY>
+	constexpr BasicString<CharT, Alloc, SSO_CAPACITY>::const_reverse_iterator BasicString<CharT, Alloc, SSO_CAPACITY>::crbegin() const noexcept {
 		if (this->m_isSSO())
 			return const_reverse_iterator(this, this->m_sso.buffer + m_content.size - 1);
 		return const_reverse_iterator(this, this->m_heap.start + m_content.size - 1);
 	}
 
 
-	template <typename CharT, sl::memory::IsAllocator Alloc>
-	constexpr BasicString<CharT, Alloc>::const_reverse_iterator BasicString<CharT, Alloc>::crend() const noexcept {
+	template <typename CharT, sl::memory::IsAllocator Alloc, std::size_t SSO_CAPACITY>
+	constexpr BasicString<CharT, Alloc, SSO_CAPACITY>::const_reverse_iterator BasicString<CharT, Alloc, SSO_CAPACITY>::crend() const noexcept {
 		if (this->m_isSSO())
 			return const_reverse_iterator(this, this->m_sso.buffer - 1);
 		return const_reverse_iterator(this, this->m_heap.start - 1);
 	}
 
 
-	template <typename CharT, sl::memory::IsAllocator Alloc>
-	constexpr const CharT *BasicString<CharT, Alloc>::getData() const noexcept {
+	template <typename CharT, sl::memory::IsAllocator Alloc, std::size_t SSO_CAPACITY>
+	constexpr const CharT *BasicString<CharT, Alloc, SSO_CAPACITY>::getData() const noexcept {
 		if (this->m_isSSO())
 			return m_sso.buffer;
 		return &*m_heap.start;
 	}
 
 
-	template <typename CharT, sl::memory::IsAllocator Alloc>
-	constexpr BasicString<CharT, Alloc>::size_type BasicString<CharT, Alloc>::getSize() const noexcept {
+	template <typename CharT, sl::memory::IsAllocator Alloc, std::size_t SSO_CAPACITY>
+	constexpr BasicString<CharT, Alloc, SSO_CAPACITY>::size_type BasicString<CharT, Alloc, SSO_CAPACITY>::getSize() const noexcept {
 		return m_content.size;
 	}
 
 
-	template <typename CharT, sl::memory::IsAllocator Alloc>
-	constexpr BasicString<CharT, Alloc>::size_type BasicString<CharT, Alloc>::getCapacity() const noexcept {
+	template <typename CharT, sl::memory::IsAllocator Alloc, std::size_t SSO_CAPACITY>
+	constexpr BasicString<CharT, Alloc, SSO_CAPACITY>::size_type BasicString<CharT, Alloc, SSO_CAPACITY>::getCapacity() const noexcept {
 		if (this->m_isSSO())
 			return MAX_SSO_CAPACITY;
 		return m_heap.capacity;
 	}
 
 
-	template <typename CharT, sl::memory::IsAllocator Alloc>
-	constexpr bool BasicString<CharT, Alloc>::m_isSSO() const noexcept {
+	template <typename CharT, sl::memory::IsAllocator Alloc, std::size_t SSO_CAPACITY>
+	constexpr bool BasicString<CharT, Alloc, SSO_CAPACITY>::m_isSSO() const noexcept {
+		if constexpr (IS_INLINE)
+			return true;
 		return !m_content.size.template getFlag<0> ();
 	}
 
 
-	template <typename CharT, sl::memory::IsAllocator Alloc>
-	constexpr BasicString<CharT, Alloc>::pointer BasicString<CharT, Alloc>::m_allocate(size_type size) noexcept {
+	template <typename CharT, sl::memory::IsAllocator Alloc, std::size_t SSO_CAPACITY>
+	constexpr auto BasicString<CharT, Alloc, SSO_CAPACITY>::m_release() noexcept -> void {
+		if constexpr (!IS_INLINE) {
+			if (!this->m_isSSO())
+				this->m_deallocate(m_heap.start, m_heap.capacity);
+		}
+		m_content.size = 0;
+		m_content.size.template setFlag<0> (false);
+		m_sso.buffer[0] = static_cast<CharT> ('\0');
+	}
+
+
+	template <typename CharT, sl::memory::IsAllocator Alloc, std::size_t SSO_CAPACITY>
+	constexpr auto BasicString<CharT, Alloc, SSO_CAPACITY>::m_getBuffer() noexcept -> CharT* {
+		if (this->m_isSSO())
+			return m_sso.buffer;
+		return &*m_heap.start;
+	}
+
+
+	template <typename CharT, sl::memory::IsAllocator Alloc, std::size_t SSO_CAPACITY>
+	constexpr auto BasicString<CharT, Alloc, SSO_CAPACITY>::m_grow(size_type newSize) noexcept -> void {
+		const size_type targetCapacity {newSize + 1};
+		size_type newCapacity {this->getCapacity()};
+		if (newCapacity >= targetCapacity)
+			return;
+		while (newCapacity < targetCapacity)
+			newCapacity += newCapacity / 2;
+		(void)this->reserve(newCapacity - 1);
+	}
+
+
+	template <typename CharT, sl::memory::IsAllocator Alloc, std::size_t SSO_CAPACITY>
+	constexpr auto BasicString<CharT, Alloc, SSO_CAPACITY>::m_clampInsertion(size_type count) const noexcept -> size_type {
+		if constexpr (IS_INLINE)
+			return std::min<size_type> (count, MAX_SSO_SIZE - m_content.size);
+		return count;
+	}
+
+
+	template <typename CharT, sl::memory::IsAllocator Alloc, std::size_t SSO_CAPACITY>
+	constexpr auto BasicString<CharT, Alloc, SSO_CAPACITY>::m_insert(difference_type position, const CharT *str, size_type size) noexcept -> iterator {
+		position = this->m_normalizeIndex(position, m_content.size + 1);
+		if (static_cast<size_type> (position) == m_content.size)
+			return this->m_append(str, size);
+		size = this->m_clampInsertion(size);
+
+		// moving the tail would overwrite a source that lives in our own buffer
+		const CharT *data {this->getData()};
+		if (std::less_equal<const CharT*> {} (data, str) && std::less<const CharT*> {} (str, data + m_content.size + 1)) {
+			const BasicString<CharT, Alloc, SSO_CAPACITY> copy {str, size, this->m_copyAllocator()};
+			return this->m_insert(position, copy.getData(), size);
+		}
+
+		this->m_grow(m_content.size + size);
+		CharT *buffer {this->m_getBuffer()};
+		(void)sl::utils::memmove<CharT> (buffer + position + size, buffer + position, m_content.size - position + 1);
+		(void)sl::utils::memcpy<CharT> (buffer + position, str, size);
+		m_content.size += size;
+		return this->begin() + position;
+	}
+
+
+	template <typename CharT, sl::memory::IsAllocator Alloc, std::size_t SSO_CAPACITY>
+	constexpr auto BasicString<CharT, Alloc, SSO_CAPACITY>::m_append(const CharT *str, size_type size) noexcept -> iterator {
+		const size_type position {m_content.size};
+		size = this->m_clampInsertion(size);
+		if (this->getCapacity() < position + size + 1) {
+			// appending the string to itself, the source moves with the buffer
+			const CharT *data {this->getData()};
+			const bool isSelf {std::less_equal<const CharT*> {} (data, str) && std::less<const CharT*> {} (str, data + position + 1)};
+			const size_type offset {isSelf ? static_cast<size_type> (str - data) : 0};
+			this->m_grow(position + size);
+			if (isSelf)
+				str = this->getData() + offset;
+		}
+
+		CharT *buffer {this->m_getBuffer()};
+		(void)sl::utils::memcpy<CharT> (buffer + position, str, size);
+		buffer[position + size] = static_cast<CharT> ('\0');
+		m_content.size += size;
+		return this->begin() + position;
+	}
+
+
+	template <typename CharT, sl::memory::IsAllocator Alloc, std::size_t SSO_CAPACITY>
+	constexpr auto BasicString<CharT, Alloc, SSO_CAPACITY>::m_compare(const CharT *str, size_type size) const noexcept -> std::strong_ordering {
+		const int result {sl::utils::compare(this->getData(), str, std::min<size_type> (m_content.size, size))};
+		if (result != 0)
+			return result <=> 0;
+		return m_content.size <=> size;
+	}
+
+
+	template <typename CharT, sl::memory::IsAllocator Alloc, std::size_t SSO_CAPACITY>
+	constexpr auto BasicString<CharT, Alloc, SSO_CAPACITY>::m_find(const CharT *str, size_type size, size_type start) const noexcept -> std::optional<size_type> {
+		if (start > m_content.size)
+			return std::nullopt;
+		const CharT *data {this->getData()};
+		const CharT *result {sl::utils::find(data + start, m_content.size - start, str, size)};
+		if (result == nullptr)
+			return std::nullopt;
+		return static_cast<size_type> (result - data);
+	}
+
+
+	template <typename CharT, sl::memory::IsAllocator Alloc, std::size_t SSO_CAPACITY>
+	constexpr auto BasicString<CharT, Alloc, SSO_CAPACITY>::m_rfind(const CharT *str, size_type size) const noexcept -> std::optional<size_type> {
+		const CharT *data {this->getData()};
+		const CharT *result {sl::utils::findLast(data, m_content.size, str, size)};
+		if (result == nullptr)
+			return std::nullopt;
+		return static_cast<size_type> (result - data);
+	}
+
+
+	template <typename CharT, sl::memory::IsAllocator Alloc, std::size_t SSO_CAPACITY>
+	constexpr auto BasicString<CharT, Alloc, SSO_CAPACITY>::m_startsWith(const CharT *str, size_type size) const noexcept -> bool {
+		return size <= m_content.size && sl::utils::compare(this->getData(), str, size) == 0;
+	}
+
+
+	template <typename CharT, sl::memory::IsAllocator Alloc, std::size_t SSO_CAPACITY>
+	constexpr auto BasicString<CharT, Alloc, SSO_CAPACITY>::m_endsWith(const CharT *str, size_type size) const noexcept -> bool {
+		return size <= m_content.size && sl::utils::compare(this->getData() + m_content.size - size, str, size) == 0;
+	}
+
+
+	template <typename CharT, sl::memory::IsAllocator Alloc, std::size_t SSO_CAPACITY>
+	constexpr BasicString<CharT, Alloc, SSO_CAPACITY>::pointer BasicString<CharT, Alloc, SSO_CAPACITY>::m_allocate(size_type size) noexcept {
+		static_assert(!IS_INLINE, "Inline strings never reach the heap");
 		if constexpr (sl::memory::IsAllocatorStatefull_v<Alloc>)
 			return std::allocator_traits<Alloc>::allocate(m_content.allocator, size);
 		else {
@@ -502,8 +640,9 @@ namespace sl::utils {
 	}
 
 
-	template <typename CharT, sl::memory::IsAllocator Alloc>
-	constexpr void BasicString<CharT, Alloc>::m_deallocate(pointer res, size_type size) noexcept {
+	template <typename CharT, sl::memory::IsAllocator Alloc, std::size_t SSO_CAPACITY>
+	constexpr void BasicString<CharT, Alloc, SSO_CAPACITY>::m_deallocate(pointer res, size_type size) noexcept {
+		static_assert(!IS_INLINE, "Inline strings never reach the heap");
 		if constexpr (sl::memory::IsAllocatorStatefull_v<Alloc>)
 			std::allocator_traits<Alloc>::deallocate(m_content.allocator, res, size);
 		else {
@@ -513,8 +652,8 @@ namespace sl::utils {
 	}
 
 
-	template <typename CharT, sl::memory::IsAllocator Alloc>
-	constexpr BasicString<CharT, Alloc>::difference_type BasicString<CharT, Alloc>::m_normalizeIndex(difference_type index, size_type size) const noexcept {
+	template <typename CharT, sl::memory::IsAllocator Alloc, std::size_t SSO_CAPACITY>
+	constexpr BasicString<CharT, Alloc, SSO_CAPACITY>::difference_type BasicString<CharT, Alloc, SSO_CAPACITY>::m_normalizeIndex(difference_type index, size_type size) const noexcept {
 		if (size == 0)
 			size = m_content.size;
 		index %= static_cast<difference_type> (size);
@@ -524,8 +663,8 @@ namespace sl::utils {
 	}
 
 
-	template <typename CharT, sl::memory::IsAllocator Alloc>
-	constexpr auto BasicString<CharT, Alloc>::m_copyAllocator() const noexcept -> Alloc {
+	template <typename CharT, sl::memory::IsAllocator Alloc, std::size_t SSO_CAPACITY>
+	constexpr auto BasicString<CharT, Alloc, SSO_CAPACITY>::m_copyAllocator() const noexcept -> Alloc {
 		if constexpr (sl::memory::IsAllocatorStatefull_v<Alloc>)
 			return m_content.allocator;
 		else
@@ -533,8 +672,8 @@ namespace sl::utils {
 	}
 
 
-	template <typename CharT, sl::memory::IsAllocator Alloc>
-	constexpr auto BasicString<CharT, Alloc>::s_createContent(const Alloc &alloc) noexcept -> Content<Alloc> {
+	template <typename CharT, sl::memory::IsAllocator Alloc, std::size_t SSO_CAPACITY>
+	constexpr auto BasicString<CharT, Alloc, SSO_CAPACITY>::s_createContent(const Alloc &alloc) noexcept -> Content<Alloc> {
 		if constexpr (sl::memory::IsAllocatorStatefull_v<Alloc>)
 			return Content<Alloc> {alloc, sl::utils::UnsignedIntFlagWrapper<size_type, 1> (0ULL)};
 		else
@@ -591,131 +730,15 @@ namespace sl::utils {
 
 
 
-	template <std::integral T, typename CharT, sl::memory::IsAllocator Alloc>
-	constexpr std::optional<T> stringToNumber(const sl::utils::BasicString<CharT, Alloc> &string) noexcept {
-		const sl::utils::BasicString<char> allowedDigits[17] {{}, {},
-			"01", {}, {}, {}, {}, {},
-			"01234567", {},
-			"0123456789", {}, {}, {}, {}, {},
-			"0123456789abcdef"
-		};
-
-		T result {0};
-		if (string.isEmpty())
-			return std::nullopt;
-		bool isPositive {true};
-
-		auto it {string.begin()};
-		if (*it == '-') {
-			if constexpr (std::unsigned_integral<T>)
-				return std::nullopt;
-			else {
-				if (string.getSize() == 1)
-					return std::nullopt;
-				isPositive = false;
-				++it;
-			}
-		}
-
-		else if (*it == '+')
-			++it;
-
-		T base {10};
-		if (*it == '0') {
-			++it;
-			if (*it == 'b') {
-				base = 2;
-				++it;
-			}
-			else if (*it == 'x') {
-				base = 16;
-				++it;
-			}
-			else if (*it == 'o') {
-				base = 8;
-				++it;
-			}
-		}
-
-		const sl::utils::BasicString<char> &baseDigits {allowedDigits[base]};
-
-		for (; it != string.end(); ++it) {
-			auto digit {std::ranges::find(baseDigits, *it)};
-			if (digit == baseDigits.end())
-				return std::nullopt;
-			T value {static_cast<T> (digit - baseDigits.begin())};
-			const T position {static_cast<T> (string.end() - it - 1)};
-			value *= std::pow(base, position);
-			result += value;
-		}
-
-		return isPositive ? result : -result;
+	template <std::integral T, typename CharT, sl::memory::IsAllocator Alloc, std::size_t SSO_CAPACITY>
+	constexpr std::optional<T> stringToNumber(const sl::utils::BasicString<CharT, Alloc, SSO_CAPACITY> &string) noexcept {
+		return sl::utils::stringToNumber<T> (string.getData(), string.getSize());
 	}
 
 
-	template <std::floating_point T, typename CharT, sl::memory::IsAllocator Alloc>
-	constexpr std::optional<T> stringToNumber(const sl::utils::BasicString<CharT, Alloc> &string) noexcept {
-		const sl::utils::BasicString<char> digits {"0123456789"};
-
-		T result {0};
-		T exponant {0};
-		if (string.isEmpty())
-			return std::nullopt;
-		bool isPositive {true};
-		auto it {string.begin()};
-		if (*it == '-') {
-			if (string.getSize() == 1)
-				return std::nullopt;
-			isPositive = false;
-			++it;
-		}
-
-		if (std::ranges::count(string, '.') > 1)
-			return std::nullopt;
-		if (std::ranges::count(string, 'e') > 1)
-			return std::nullopt;
-		auto dotIt {std::ranges::find(string, '.')};
-		auto sciIt {std::ranges::find(string, 'e')};
-		if (dotIt != string.end() && dotIt > sciIt)
-			return std::nullopt;
-
-		bool exponentIsPositive {true};
-		for (; it != string.end(); ++it) {
-			if (it == dotIt || it == sciIt)
-				continue;
-
-			if (it == sciIt + 1) {
-				if (*it == '-') {
-					exponentIsPositive = false;
-					continue;
-				}
-				if (*it == '+')
-					continue;
-			}
-
-			auto digit {std::ranges::find(digits, *it)};
-			if (digit == digits.end())
-				return std::nullopt;
-			T value {static_cast<T> (digit - digits.begin())};
-
-			if (it > sciIt) {
-				const T position {static_cast<T> (string.end() - it - 1)};
-				value *= std::pow(static_cast<T> (10), position);
-				exponant += value;
-				continue;
-			}
-
-			T position {};
-			if (it > dotIt)
-				position = static_cast<T> (dotIt - it);
-			else
-				position = static_cast<T> (std::min(dotIt, sciIt) - it - 1);
-			value *= std::pow(static_cast<T> (10), position);
-			result += value;
-		}
-
-		result *= std::pow(static_cast<T> (10), exponentIsPositive ? exponant : -exponant);
-		return isPositive ? result : -result;
+	template <std::floating_point T, typename CharT, sl::memory::IsAllocator Alloc, std::size_t SSO_CAPACITY>
+	constexpr std::optional<T> stringToNumber(const sl::utils::BasicString<CharT, Alloc, SSO_CAPACITY> &string) noexcept {
+		return sl::utils::stringToNumber<T> (string.getData(), string.getSize());
 	}
 
  } // namespace sl::utils
@@ -0,0 +1,112 @@
+#pragma once
+
+#include <atomic>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+
+#include "sl/core.hpp"
+#include "sl/memory/stackAllocator.hpp"
+#include "sl/utils/hash.hpp"
+#include "sl/utils/string.hpp"
+
+
+namespace sl::utils {
+	/*
+	 * Stable 64-bit identifier of a string. The identifier is a hash of the string, so it is the same at compile
+	 * time, at runtime and from one run to the next, and comparing or hashing names is a single integer operation.
+	 * 64 bits keep collisions out of reach of any realistic number of names, and the StringIdTable reports the
+	 * ones it sees. The string itself can be retrieved once it was interned in the StringIdTable
+	 */
+	class StringId final {
+		public:
+			using value_type = std::uint64_t;
+
+			constexpr StringId() noexcept : m_value {s_hash("", 0)} {}
+			constexpr explicit StringId(value_type value) noexcept : m_value {value} {}
+			constexpr StringId(const char *str, std::size_t size) noexcept : m_value {s_hash(str, size)} {}
+			constexpr ~StringId() = default;
+
+			constexpr StringId(const StringId &) noexcept = default;
+			constexpr auto operator=(const StringId &) noexcept -> StringId& = default;
+			constexpr StringId(StringId &&) noexcept = default;
+			constexpr auto operator=(StringId &&) noexcept -> StringId& = default;
+
+			constexpr auto operator==(const StringId &) const noexcept -> bool = default;
+			constexpr auto operator<=>(const StringId &) const noexcept -> std::strong_ordering = default;
+
+			constexpr auto getValue() const noexcept -> value_type {return m_value;}
+
+		private:
+			static constexpr auto s_hash(const char *str, std::size_t size) noexcept -> value_type {
+				return static_cast<value_type> (sl::utils::hash<value_type> (str, size));
+			}
+
+			value_type m_value;
+	};
+
+
+	/*
+	 * Global table of the interned strings. Lookups never lock: the slots are published atomically, and the tables
+	 * replaced by a growth stay alive for the readers still using them. Interning a new string locks a mutex, and
+	 * copies the string into an arena, so the returned pointers stay valid until the end of the program. Interning
+	 * a string whose id already belongs to another string asserts, on the lock-free and on the locked path
+	 */
+	class SL_CORE StringIdTable final {
+		public:
+			StringIdTable() = delete;
+
+			static auto intern(const char *str, std::size_t size) noexcept -> StringId;
+			static auto intern(const char *str) noexcept -> StringId {return intern(str, std::char_traits<char>::length(str));}
+			template <sl::memory::IsAllocator Alloc, std::size_t SSO_CAPACITY>
+			static auto intern(const sl::utils::BasicString<char, Alloc, SSO_CAPACITY> &str) noexcept -> StringId {return intern(str.getData(), str.getSize());}
+			static auto intern(sl::utils::StringView str) noexcept -> StringId {return intern(str.getData(), str.getSize());}
+
+			// Returns the null-terminated interned string, or nullptr if `id` wasn't interned
+			static auto find(StringId id) noexcept -> const char*;
+			static auto getSize() noexcept -> std::size_t;
+
+		private:
+			struct Entry {
+				StringId id;
+				std::uint32_t size;
+				const char *data;
+			};
+
+			struct Table {
+				std::size_t capacity;
+				std::atomic<const Entry*> *slots;
+			};
+
+			struct Storage {
+				Storage() noexcept;
+
+				sl::memory::StackAllocator arena;
+				std::mutex mutex;
+				std::atomic<const Table*> table;
+				std::size_t size;
+			};
+
+			static auto s_getStorage() noexcept -> Storage&;
+			static auto s_probe(const Table &table, StringId id) noexcept -> std::atomic<const Entry*>&;
+			static auto s_createTable(Storage &storage, std::size_t capacity) noexcept -> Table*;
+	};
+
+
+	namespace literals {
+		constexpr auto operator ""_sid(const char *str, std::size_t N) noexcept -> StringId {return StringId(str, N);}
+	} // namespace literals
+
+	using namespace sl::utils::literals;
+
+} // namespace sl::utils
+
+
+template <>
+struct std::hash<sl::utils::StringId> {
+	auto operator()(const sl::utils::StringId &id) const noexcept -> std::size_t {
+		return std::hash<sl::utils::StringId::value_type> {} (id.getValue());
+	}
+};
@@ -0,0 +1,106 @@
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+
+#include "sl/core.hpp"
+
+
+namespace sl::utils {
+	/*
+	 * Runtime search and comparison kernels on bytes. On x86-64 they use AVX2 when the CPU supports it and SSE2
+	 * otherwise, with a scalar fallback on other architectures. The find functions return nullptr when nothing
+	 * is found
+	 */
+	namespace simd {
+		SL_CORE auto findChar(const char *data, std::size_t size, char value) noexcept -> const char*;
+		SL_CORE auto findLastChar(const char *data, std::size_t size, char value) noexcept -> const char*;
+		// Filters the candidates on the first and last characters of `pattern` before comparing the whole pattern
+		SL_CORE auto find(const char *data, std::size_t size, const char *pattern, std::size_t patternSize) noexcept -> const char*;
+		SL_CORE auto findLast(const char *data, std::size_t size, const char *pattern, std::size_t patternSize) noexcept -> const char*;
+		// Same result as std::memcmp
+		SL_CORE auto compare(const char *lhs, const char *rhs, std::size_t size) noexcept -> int;
+	} // namespace simd
+
+
+	// The functions below forward to the simd kernels for byte characters, and fall back to loops at compile time
+	template <typename CharT>
+	constexpr auto findChar(const CharT *data, std::size_t size, CharT value) noexcept -> const CharT* {
+		if constexpr (sizeof(CharT) == 1) {
+			if (!std::is_constant_evaluated())
+				return reinterpret_cast<const CharT*> (simd::findChar(reinterpret_cast<const char*> (data), size, static_cast<char> (value)));
+		}
+		for (std::size_t i {0}; i < size; ++i) {
+			if (data[i] == value)
+				return data + i;
+		}
+		return nullptr;
+	}
+
+
+	template <typename CharT>
+	constexpr auto findLastChar(const CharT *data, std::size_t size, CharT value) noexcept -> const CharT* {
+		if constexpr (sizeof(CharT) == 1) {
+			if (!std::is_constant_evaluated())
+				return reinterpret_cast<const CharT*> (simd::findLastChar(reinterpret_cast<const char*> (data), size, static_cast<char> (value)));
+		}
+		for (std::size_t i {size}; i-- != 0;) {
+			if (data[i] == value)
+				return data + i;
+		}
+		return nullptr;
+	}
+
+
+	template <typename CharT>
+	constexpr auto compare(const CharT *lhs, const CharT *rhs, std::size_t size) noexcept -> int {
+		if constexpr (sizeof(CharT) == 1) {
+			if (!std::is_constant_evaluated())
+				return simd::compare(reinterpret_cast<const char*> (lhs), reinterpret_cast<const char*> (rhs), size);
+		}
+		for (std::size_t i {0}; i < size; ++i) {
+			if (lhs[i] != rhs[i])
+				return static_cast<std::make_unsigned_t<CharT>> (lhs[i]) < static_cast<std::make_unsigned_t<CharT>> (rhs[i]) ? -1 : 1;
+		}
+		return 0;
+	}
+
+
+	template <typename CharT>
+	constexpr auto find(const CharT *data, std::size_t size, const CharT *pattern, std::size_t patternSize) noexcept -> const CharT* {
+		if constexpr (sizeof(CharT) == 1) {
+			if (!std::is_constant_evaluated()) {
+				return reinterpret_cast<const CharT*> (simd::find(
+					reinterpret_cast<const char*> (data), size, reinterpret_cast<const char*> (pattern), patternSize
+				));
+			}
+		}
+		if (patternSize > size)
+			return nullptr;
+		for (std::size_t i {0}; i <= size - patternSize; ++i) {
+			if (sl::utils::compare(data + i, pattern, patternSize) == 0)
+				return data + i;
+		}
+		return nullptr;
+	}
+
+
+	template <typename CharT>
+	constexpr auto findLast(const CharT *data, std::size_t size, const CharT *pattern, std::size_t patternSize) noexcept -> const CharT* {
+		if constexpr (sizeof(CharT) == 1) {
+			if (!std::is_constant_evaluated()) {
+				return reinterpret_cast<const CharT*> (simd::findLast(
+					reinterpret_cast<const char*> (data), size, reinterpret_cast<const char*> (pattern), patternSize
+				));
+			}
+		}
+		if (patternSize > size)
+			return nullptr;
+		for (std::size_t i {size - patternSize + 1}; i-- != 0;) {
+			if (sl::utils::compare(data + i, pattern, patternSize) == 0)
+				return data + i;
+		}
+		return nullptr;
+	}
+
+} // namespace sl::utils
@@ -0,0 +1,346 @@
+#pragma once
+
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <optional>
+#include <type_traits>
+
+#include "sl/core.hpp"
+
+
+namespace sl::utils {
+	/*
+	 * Correctly rounded conversions of a decimal number, through std::from_chars. They are the slow path of
+	 * stringToNumber, called with an unsigned number it already validated. Return std::nullopt when the number is out
+	 * of the range of the type
+	 */
+	namespace charconv {
+		SL_CORE auto toFloat(const char *str, std::size_t size) noexcept -> std::optional<float>;
+		SL_CORE auto toDouble(const char *str, std::size_t size) noexcept -> std::optional<double>;
+		SL_CORE auto toLongDouble(const char *str, std::size_t size) noexcept -> std::optional<long double>;
+	} // namespace charconv
+
+
+	// Returns `base` if `character` is not a digit of `base`
+	template <typename CharT>
+	constexpr auto __stringToNumber_digit(CharT character, std::uint32_t base) noexcept -> std::uint32_t {
+		std::uint32_t digit {base};
+		if (character >= '0' && character <= '9')
+			digit = static_cast<std::uint32_t> (character - '0');
+		else if (character >= 'a' && character <= 'f')
+			digit = static_cast<std::uint32_t> (character - 'a') + 10;
+		else if (character >= 'A' && character <= 'F')
+			digit = static_cast<std::uint32_t> (character - 'A') + 10;
+		return digit < base ? digit : base;
+	}
+
+
+	// Reads 8 byte characters as a little-endian 64-bit integer
+	template <typename CharT>
+	constexpr auto __stringToNumber_read8(const CharT *str) noexcept -> std::uint64_t {
+		static_assert(sizeof(CharT) == 1);
+		if (!std::is_constant_evaluated() && std::endian::native == std::endian::little) {
+			std::uint64_t value {0};
+			std::memcpy(&value, str, 8);
+			return value;
+		}
+
+		std::uint64_t value {0};
+		for (std::size_t i {0}; i < 8; ++i)
+			value |= static_cast<std::uint64_t> (static_cast<std::uint8_t> (str[i])) << (8 * i);
+		return value;
+	}
+
+
+	// SWAR check that the 8 bytes of `value` are ASCII digits
+	constexpr auto __stringToNumber_isEightDigits(std::uint64_t value) noexcept -> bool {
+		return ((value & 0xf0f0f0f0f0f0f0f0) | (((value + 0x0606060606060606) & 0xf0f0f0f0f0f0f0f0) >> 4)) == 0x3333333333333333;
+	}
+
+
+	// SWAR conversion of 8 ASCII digits, read by __stringToNumber_read8, in 3 multiplications
+	constexpr auto __stringToNumber_parseEightDigits(std::uint64_t value) noexcept -> std::uint64_t {
+		constexpr std::uint64_t MASK {0x000000ff000000ff};
+		constexpr std::uint64_t HUNDREDS {100 + (1000000ull << 32)};
+		constexpr std::uint64_t UNITS {1 + (10000ull << 32)};
+		value -= 0x3030303030303030;
+		value = value * 10 + (value >> 8);
+		return (((value & MASK) * HUNDREDS) + (((value >> 16) & MASK) * UNITS)) >> 32;
+	}
+
+
+	// Appends the chunks of 8 decimal digits starting at `it` to `value`, at most `maxChunks` of them
+	template <typename CharT>
+	constexpr auto __stringToNumber_parseChunks(const CharT *&it, const CharT *end, std::uint64_t &value, std::size_t maxChunks) noexcept -> void {
+		if constexpr (sizeof(CharT) == 1) {
+			for (; maxChunks != 0 && end - it >= 8; --maxChunks, it += 8) {
+				const std::uint64_t chunk {__stringToNumber_read8(it)};
+				if (!__stringToNumber_isEightDigits(chunk))
+					return;
+				value = value * 100'000'000 + __stringToNumber_parseEightDigits(chunk);
+			}
+		}
+	}
+
+
+	// Parses the digits of any base with overflow checks, returns false on an invalid digit or an overflow
+	template <typename CharT>
+	constexpr auto __stringToNumber_parseMagnitude(const CharT *it, const CharT *end, std::uint32_t base, std::uint64_t &magnitude) noexcept -> bool {
+		const std::uint64_t maxBeforeMultiply {std::numeric_limits<std::uint64_t>::max() / base};
+		for (; it != end; ++it) {
+			const std::uint32_t digit {__stringToNumber_digit(*it, base)};
+			if (digit == base || magnitude > maxBeforeMultiply)
+				return false;
+			const std::uint64_t shifted {magnitude * base};
+			magnitude = shifted + digit;
+			if (magnitude < shifted)
+				return false;
+		}
+		return true;
+	}
+
+
+	/*
+	 * Parses a whole span as an integer, with an optional sign and an optional `0b`, `0o` or `0x` base prefix.
+	 * Returns std::nullopt if the span contains anything else or if the number doesn't fit in T
+	 */
+	template <std::integral T, typename CharT>
+	constexpr auto stringToNumber(const CharT *str, std::size_t size) noexcept -> std::optional<T> {
+		const CharT *it {str};
+		const CharT *const end {str + size};
+		if (it == end)
+			return std::nullopt;
+
+		bool isNegative {false};
+		if (*it == '-') {
+			if constexpr (std::unsigned_integral<T>)
+				return std::nullopt;
+			isNegative = true;
+			++it;
+		}
+		else if (*it == '+')
+			++it;
+
+		std::uint32_t base {10};
+		if (end - it >= 2 && it[0] == '0') {
+			if (it[1] == 'b')
+				base = 2;
+			else if (it[1] == 'o')
+				base = 8;
+			else if (it[1] == 'x')
+				base = 16;
+			if (base != 10)
+				it += 2;
+		}
+		if (it == end)
+			return std::nullopt;
+
+		// up to 19 decimal digits can't overflow, everything else takes the generic loop
+		std::uint64_t magnitude {0};
+		if (base == 10 && end - it <= 19) {
+			__stringToNumber_parseChunks(it, end, magnitude, 2);
+			for (; it != end; ++it) {
+				const auto digit {static_cast<std::uint32_t> (*it - '0')};
+				if (digit > 9)
+					return std::nullopt;
+				magnitude = magnitude * 10 + digit;
+			}
+		}
+		else if (!__stringToNumber_parseMagnitude(it, end, base, magnitude))
+			return std::nullopt;
+
+		using Unsigned = std::make_unsigned_t<T>;
+		const std::uint64_t limit {static_cast<std::uint64_t> (std::numeric_limits<T>::max()) + (isNegative ? 1 : 0)};
+		if (magnitude > limit)
+			return std::nullopt;
+		if (isNegative)
+			return static_cast<T> (static_cast<Unsigned> (0) - static_cast<Unsigned> (magnitude));
+		return static_cast<T> (magnitude);
+	}
+
+
+	/*
+	 * Recomputes the mantissa of a decimal number with more than 19 digits from its first 19 significant digits, and
+	 * returns the power of ten to apply to it. Sets `isTruncated` if a dropped digit is not zero
+	 */
+	template <typename CharT>
+	constexpr auto __stringToNumber_truncate(
+		const CharT *it,
+		const CharT *end,
+		std::uint64_t &mantissa,
+		bool &isTruncated
+	) noexcept -> std::int64_t {
+		constexpr std::size_t MAX_DIGITS {19};
+		std::int64_t exponent {0};
+		std::size_t significantDigitCount {0};
+		bool isFraction {false};
+		mantissa = 0;
+		for (; it != end; ++it) {
+			if (*it == '.') {
+				isFraction = true;
+				continue;
+			}
+			const std::uint32_t digit {static_cast<std::uint32_t> (*it - '0')};
+			if (significantDigitCount < MAX_DIGITS) {
+				if (mantissa != 0 || digit != 0) {
+					mantissa = mantissa * 10 + digit;
+					++significantDigitCount;
+				}
+				exponent -= isFraction ? 1 : 0;
+			}
+			else {
+				isTruncated |= digit != 0;
+				exponent += isFraction ? 0 : 1;
+			}
+		}
+		return exponent;
+	}
+
+
+	/*
+	 * Converts the unsigned decimal number [unsignedBegin, end), already split in `mantissa` and `exponent`, when Clinger's fast
+	 * path can't. Correctly rounded at runtime, but only approximated at compile time
+	 */
+	template <std::floating_point T, typename CharT>
+	constexpr auto __stringToNumber_slowFloat(
+		const CharT *unsignedBegin,
+		const CharT *end,
+		std::uint64_t mantissa,
+		std::int64_t exponent
+	) noexcept -> std::optional<T> {
+		if (!std::is_constant_evaluated()) {
+			char narrow[128] {};
+			const char *unsignedStr {reinterpret_cast<const char*> (unsignedBegin)};
+			const std::size_t unsignedSize {static_cast<std::size_t> (end - unsignedBegin)};
+			if constexpr (sizeof(CharT) != 1) {
+				if (unsignedSize <= sizeof(narrow)) {
+					for (std::size_t i {0}; i < unsignedSize; ++i)
+						narrow[i] = static_cast<char> (unsignedBegin[i]);
+					unsignedStr = narrow;
+				}
+				else
+					unsignedStr = nullptr;
+			}
+
+			if (unsignedStr != nullptr) {
+				if constexpr (std::same_as<T, float>)
+					return charconv::toFloat(unsignedStr, unsignedSize);
+				else if constexpr (std::same_as<T, double>)
+					return charconv::toDouble(unsignedStr, unsignedSize);
+				else
+					return charconv::toLongDouble(unsignedStr, unsignedSize);
+			}
+		}
+
+		long double approximation {static_cast<long double> (mantissa)};
+		long double power {10};
+		for (std::uint64_t remaining {static_cast<std::uint64_t> (exponent < 0 ? -exponent : exponent)}; remaining != 0; remaining >>= 1) {
+			if (remaining & 1)
+				approximation = exponent < 0 ? approximation / power : approximation * power;
+			if (remaining > 1)
+				power *= power;
+		}
+		if (approximation == 0 || approximation > static_cast<long double> (std::numeric_limits<T>::max()))
+			return std::nullopt;
+		return static_cast<T> (approximation);
+	}
+
+
+	/*
+	 * Parses a whole span as a decimal floating point number : an optional sign, digits with an optional dot, and an
+	 * optional exponent introduced by `e` or `E`. The digits are accumulated in a 64-bit integer, and the inputs
+	 * whose mantissa and power of ten are both exact in T are converted with one multiplication or division, which is
+	 * correctly rounded (Clinger's fast path). The other inputs go through charconv at runtime, and through an
+	 * approximation at compile time
+	 */
+	template <std::floating_point T, typename CharT>
+	constexpr auto stringToNumber(const CharT *str, std::size_t size) noexcept -> std::optional<T> {
+		constexpr std::uint64_t MAX_EXACT_MANTISSA {sizeof(T) == sizeof(float) ? (1ull << 24) : (1ull << 53)};
+		constexpr std::int64_t MAX_EXACT_POWER {sizeof(T) == sizeof(float) ? 10 : 22};
+		constexpr T POWERS_OF_TEN[23] {
+			1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+			1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+		};
+		const auto isDigit = [](CharT character) constexpr noexcept {return character >= '0' && character <= '9';};
+
+		const CharT *it {str};
+		const CharT *const end {str + size};
+		bool isNegative {false};
+		if (it != end && (*it == '-' || *it == '+')) {
+			isNegative = *it == '-';
+			++it;
+		}
+		const CharT *const unsignedBegin {it};
+
+		// may overflow with more than 19 digits, the mantissa is then recomputed by __stringToNumber_truncate
+		std::uint64_t mantissa {0};
+		for (; it != end && isDigit(*it); ++it)
+			mantissa = mantissa * 10 + static_cast<std::uint64_t> (*it - '0');
+		std::size_t digitCount {static_cast<std::size_t> (it - unsignedBegin)};
+
+		std::int64_t fractionDigitCount {0};
+		if (it != end && *it == '.') {
+			++it;
+			const CharT *const fractionBegin {it};
+			__stringToNumber_parseChunks(it, end, mantissa, 2);
+			for (; it != end && isDigit(*it); ++it)
+				mantissa = mantissa * 10 + static_cast<std::uint64_t> (*it - '0');
+			fractionDigitCount = it - fractionBegin;
+			digitCount += static_cast<std::size_t> (fractionDigitCount);
+		}
+		if (digitCount == 0)
+			return std::nullopt;
+		const CharT *const mantissaEnd {it};
+
+		std::int64_t exponent {0};
+		if (it != end && (*it == 'e' || *it == 'E')) {
+			++it;
+			bool isExponentNegative {false};
+			if (it != end && (*it == '-' || *it == '+')) {
+				isExponentNegative = *it == '-';
+				++it;
+			}
+			if (it == end)
+				return std::nullopt;
+
+			std::int64_t explicitExponent {0};
+			for (; it != end; ++it) {
+				if (!isDigit(*it))
+					return std::nullopt;
+				// saturates, anything that far is out of range or zero anyway
+				if (explicitExponent < 100'000)
+					explicitExponent = explicitExponent * 10 + (*it - '0');
+			}
+			exponent = isExponentNegative ? -explicitExponent : explicitExponent;
+		}
+		if (it != end)
+			return std::nullopt;
+
+		bool isTruncated {false};
+		if (digitCount > 19)
+			exponent += __stringToNumber_truncate(unsignedBegin, mantissaEnd, mantissa, isTruncated);
+		else
+			exponent -= fractionDigitCount;
+
+		if (mantissa == 0)
+			return isNegative ? -static_cast<T> (0) : static_cast<T> (0);
+		if (!isTruncated && mantissa <= MAX_EXACT_MANTISSA && exponent >= -MAX_EXACT_POWER && exponent <= MAX_EXACT_POWER) {
+			T value {static_cast<T> (mantissa)};
+			if (exponent < 0)
+				value /= POWERS_OF_TEN[-exponent];
+			else
+				value *= POWERS_OF_TEN[exponent];
+			return isNegative ? -value : value;
+		}
+
+		const std::optional<T> value {__stringToNumber_slowFloat<T> (unsignedBegin, end, mantissa, exponent)};
+		if (!value)
+			return std::nullopt;
+		return isNegative ? -*value : *value;
+	}
+
+} // namespace sl::utils
@@ -0,0 +1,203 @@
+#pragma once
+
+#include <compare>
+#include <cstddef>
+#include <iterator>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include "sl/memory/allocator.hpp"
+#include "sl/utils/stringSearch.hpp"
+#include "sl/utils/stringToNumber.hpp"
+
+
+namespace sl::utils {
+	template <typename CharT, sl::memory::IsAllocator Alloc, std::size_t SSO_CAPACITY>
+	class BasicString;
+
+	template <typename CharT, typename Delimiter, bool IS_TOKENIZER>
+	class BasicStringSplitRange;
+
+
+	/*
+	 * Non-owning view of a contiguous range of characters. It converts implicitly from BasicString and from a
+	 * null-terminated string, so that the functions taking a view never allocate nor copy. The viewed characters must
+	 * outlive the view, and they are not null-terminated
+	 */
+	template <typename CharT>
+	class BasicStringView final {
+		public:
+			using value_type = CharT;
+			using size_type = std::size_t;
+			using difference_type = std::ptrdiff_t;
+			using const_reference = const CharT&;
+			using const_pointer = const CharT*;
+
+			using iterator = const CharT*;
+			using const_iterator = const CharT*;
+			using reverse_iterator = std::reverse_iterator<const CharT*>;
+			using const_reverse_iterator = std::reverse_iterator<const CharT*>;
+
+			static constexpr size_type NPOS {static_cast<size_type> (-1)};
+
+
+			constexpr BasicStringView() noexcept : m_data {EMPTY}, m_size {0} {}
+			constexpr BasicStringView(const CharT *str) noexcept : m_data {str}, m_size {std::char_traits<CharT>::length(str)} {}
+			constexpr BasicStringView(const CharT *str, size_type size) noexcept : m_data {str}, m_size {size} {}
+			template <sl::memory::IsAllocator Alloc, std::size_t SSO_CAPACITY>
+			constexpr BasicStringView(const BasicString<CharT, Alloc, SSO_CAPACITY> &str) noexcept : m_data {str.getData()}, m_size {str.getSize()} {}
+			constexpr explicit BasicStringView(std::basic_string_view<CharT> str) noexcept : m_data {str.data()}, m_size {str.size()} {}
+			constexpr ~BasicStringView() = default;
+
+			constexpr BasicStringView(const BasicStringView<CharT> &) noexcept = default;
+			constexpr auto operator=(const BasicStringView<CharT> &) noexcept -> BasicStringView<CharT>& = default;
+
+			constexpr operator std::basic_string_view<CharT>() const noexcept {return std::basic_string_view<CharT> {m_data, m_size};}
+
+			constexpr auto operator==(BasicStringView<CharT> str) const noexcept -> bool {
+				return m_size == str.m_size && sl::utils::compare(m_data, str.m_data, m_size) == 0;
+			}
+			constexpr auto compare(BasicStringView<CharT> str) const noexcept -> std::strong_ordering;
+			constexpr auto operator<=>(BasicStringView<CharT> str) const noexcept -> std::strong_ordering {return this->compare(str);}
+
+			// Searches return the index of the first character of the match
+			constexpr auto find(CharT value, size_type start = 0) const noexcept -> std::optional<size_type>;
+			constexpr auto find(BasicStringView<CharT> str, size_type start = 0) const noexcept -> std::optional<size_type>;
+			constexpr auto rfind(CharT value) const noexcept -> std::optional<size_type>;
+			constexpr auto rfind(BasicStringView<CharT> str) const noexcept -> std::optional<size_type>;
+			constexpr auto contains(CharT value) const noexcept -> bool {return this->find(value).has_value();}
+			constexpr auto contains(BasicStringView<CharT> str) const noexcept -> bool {return this->find(str).has_value();}
+			constexpr auto startsWith(BasicStringView<CharT> str) const noexcept -> bool {
+				return str.m_size <= m_size && sl::utils::compare(m_data, str.m_data, str.m_size) == 0;
+			}
+			constexpr auto endsWith(BasicStringView<CharT> str) const noexcept -> bool {
+				return str.m_size <= m_size && sl::utils::compare(m_data + m_size - str.m_size, str.m_data, str.m_size) == 0;
+			}
+
+			// Both are clamped to the size of the view
+			constexpr auto subView(size_type start, size_type count = NPOS) const noexcept -> BasicStringView<CharT>;
+			constexpr auto popFront(size_type count = 1) noexcept -> void;
+			constexpr auto popBack(size_type count = 1) noexcept -> void;
+
+			/*
+			 * Lazy ranges of subviews. `split` gives every piece between two occurrences of the delimiter, including
+			 * the empty ones, and `tokenize` gives the non-empty pieces between any of the delimiter characters
+			 */
+			constexpr auto split(CharT delimiter) const noexcept -> BasicStringSplitRange<CharT, CharT, false>;
+			constexpr auto split(BasicStringView<CharT> delimiter) const noexcept -> BasicStringSplitRange<CharT, BasicStringView<CharT>, false>;
+			constexpr auto tokenize(CharT delimiter) const noexcept -> BasicStringSplitRange<CharT, CharT, true>;
+			constexpr auto tokenize(BasicStringView<CharT> delimiters) const noexcept -> BasicStringSplitRange<CharT, BasicStringView<CharT>, true>;
+
+			constexpr auto operator[](size_type index) const noexcept -> const_reference {return m_data[index];}
+
+			constexpr auto begin() const noexcept -> const_iterator {return m_data;}
+			constexpr auto end() const noexcept -> const_iterator {return m_data + m_size;}
+			constexpr auto cbegin() const noexcept -> const_iterator {return m_data;}
+			constexpr auto cend() const noexcept -> const_iterator {return m_data + m_size;}
+			constexpr auto rbegin() const noexcept -> const_reverse_iterator {return const_reverse_iterator(this->end());}
+			constexpr auto rend() const noexcept -> const_reverse_iterator {return const_reverse_iterator(this->begin());}
+
+			constexpr auto isEmpty() const noexcept -> bool {return m_size == 0;}
+			constexpr auto getData() const noexcept -> const CharT* {return m_data;}
+			constexpr auto getSize() const noexcept -> size_type {return m_size;}
+
+
+		private:
+			static constexpr CharT EMPTY[1] {};
+
+			const CharT *m_data;
+			size_type m_size;
+	};
+
+
+	/*
+	 * Forward range returned by BasicStringView::split and BasicStringView::tokenize. `Delimiter` is either a single
+	 * character, or a view which is a whole delimiter for `split` and a set of delimiter characters for `tokenize`
+	 */
+	template <typename CharT, typename Delimiter, bool IS_TOKENIZER>
+	class BasicStringSplitRange final {
+		public:
+			class Iterator final {
+				public:
+					using iterator_concept = std::forward_iterator_tag;
+					using iterator_category = std::forward_iterator_tag;
+					using value_type = BasicStringView<CharT>;
+					using difference_type = std::ptrdiff_t;
+					using pointer = const BasicStringView<CharT>*;
+					using reference = const BasicStringView<CharT>&;
+
+					constexpr Iterator() noexcept = default;
+					constexpr Iterator(BasicStringView<CharT> source, Delimiter delimiter) noexcept;
+
+					constexpr auto operator==(const Iterator &iterator) const noexcept -> bool {
+						return m_isDone == iterator.m_isDone && (m_isDone || m_current.getData() == iterator.m_current.getData());
+					}
+					constexpr auto operator==(std::default_sentinel_t) const noexcept -> bool {return m_isDone;}
+
+					constexpr auto operator++() noexcept -> Iterator& {this->m_advance(); return *this;}
+					constexpr auto operator++(int) noexcept -> Iterator {Iterator tmp {*this}; this->m_advance(); return tmp;}
+
+					constexpr auto operator*() const noexcept -> reference {return m_current;}
+					constexpr auto operator->() const noexcept -> pointer {return &m_current;}
+
+				private:
+					constexpr auto m_advance() noexcept -> void;
+					constexpr auto m_isDelimiter(CharT character) const noexcept -> bool;
+
+					BasicStringView<CharT> m_current {};
+					// start of the rest of the source, nullptr once the last piece of a split was reached
+					const CharT *m_next {nullptr};
+					const CharT *m_end {nullptr};
+					Delimiter m_delimiter {};
+					bool m_isDone {true};
+			};
+
+			constexpr BasicStringSplitRange(BasicStringView<CharT> source, Delimiter delimiter) noexcept :
+				m_source {source},
+				m_delimiter {delimiter}
+			{}
+
+			constexpr auto begin() const noexcept -> Iterator {return Iterator(m_source, m_delimiter);}
+			constexpr auto end() const noexcept -> std::default_sentinel_t {return std::default_sentinel;}
+
+		private:
+			BasicStringView<CharT> m_source;
+			Delimiter m_delimiter;
+	};
+
+
+	using StringView = BasicStringView<char>;
+
+	static_assert(std::ranges::contiguous_range<StringView>, "StringView type must fullfill std::ranges::contiguous_range concept");
+	static_assert(std::ranges::forward_range<BasicStringSplitRange<char, char, false>>);
+
+
+	template <std::integral T, typename CharT>
+	constexpr auto stringToNumber(BasicStringView<CharT> str) noexcept -> std::optional<T> {
+		return sl::utils::stringToNumber<T> (str.getData(), str.getSize());
+	}
+	template <std::floating_point T, typename CharT>
+	constexpr auto stringToNumber(BasicStringView<CharT> str) noexcept -> std::optional<T> {
+		return sl::utils::stringToNumber<T> (str.getData(), str.getSize());
+	}
+
+
+	namespace literals {
+		constexpr auto operator ""_sv(const char *str, std::size_t length) noexcept -> sl::utils::StringView {
+			return sl::utils::StringView(str, length);
+		}
+	} // namespace literals
+
+} // namespace sl::utils
+
+
+template <typename CharT>
+struct std::hash<sl::utils::BasicStringView<CharT>> {
+	auto operator()(const sl::utils::BasicStringView<CharT> &str) const noexcept -> std::size_t {
+		return std::hash<std::basic_string_view<CharT>> {} (str);
+	}
+};
+
+#include "sl/utils/stringView.inl"
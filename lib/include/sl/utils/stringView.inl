@@ -0,0 +1,183 @@
+#pragma once
+
+#include "sl/utils/stringView.hpp"
+
+#include <algorithm>
+
+
+namespace sl::utils {
+	template <typename CharT>
+	constexpr auto BasicStringView<CharT>::compare(BasicStringView<CharT> str) const noexcept -> std::strong_ordering {
+		const int result {sl::utils::compare(m_data, str.m_data, std::min(m_size, str.m_size))};
+		if (result != 0)
+			return result <=> 0;
+		return m_size <=> str.m_size;
+	}
+
+
+	template <typename CharT>
+	constexpr auto BasicStringView<CharT>::find(CharT value, size_type start) const noexcept -> std::optional<size_type> {
+		if (start >= m_size)
+			return std::nullopt;
+		const CharT *result {sl::utils::findChar(m_data + start, m_size - start, value)};
+		if (result == nullptr)
+			return std::nullopt;
+		return static_cast<size_type> (result - m_data);
+	}
+
+
+	template <typename CharT>
+	constexpr auto BasicStringView<CharT>::find(BasicStringView<CharT> str, size_type start) const noexcept -> std::optional<size_type> {
+		if (start > m_size)
+			return std::nullopt;
+		const CharT *result {sl::utils::find(m_data + start, m_size - start, str.m_data, str.m_size)};
+		if (result == nullptr)
+			return std::nullopt;
+		return static_cast<size_type> (result - m_data);
+	}
+
+
+	template <typename CharT>
+	constexpr auto BasicStringView<CharT>::rfind(CharT value) const noexcept -> std::optional<size_type> {
+		const CharT *result {sl::utils::findLastChar(m_data, m_size, value)};
+		if (result == nullptr)
+			return std::nullopt;
+		return static_cast<size_type> (result - m_data);
+	}
+
+
+	template <typename CharT>
+	constexpr auto BasicStringView<CharT>::rfind(BasicStringView<CharT> str) const noexcept -> std::optional<size_type> {
+		const CharT *result {sl::utils::findLast(m_data, m_size, str.m_data, str.m_size)};
+		if (result == nullptr)
+			return std::nullopt;
+		return static_cast<size_type> (result - m_data);
+	}
+
+
+	template <typename CharT>
+	constexpr auto BasicStringView<CharT>::subView(size_type start, size_type count) const noexcept -> BasicStringView<CharT> {
+		start = std::min(start, m_size);
+		return BasicStringView<CharT> (m_data + start, std::min(count, m_size - start));
+	}
+
+
+	template <typename CharT>
+	constexpr auto BasicStringView<CharT>::popFront(size_type count) noexcept -> void {
+		count = std::min(count, m_size);
+		m_data += count;
+		m_size -= count;
+	}
+
+
+	template <typename CharT>
+	constexpr auto BasicStringView<CharT>::popBack(size_type count) noexcept -> void {
+		m_size -= std::min(count, m_size);
+	}
+
+
+	template <typename CharT>
+	constexpr auto BasicStringView<CharT>::split(CharT delimiter) const noexcept -> BasicStringSplitRange<CharT, CharT, false> {
+		return BasicStringSplitRange<CharT, CharT, false> (*this, delimiter);
+	}
+
+
+	template <typename CharT>
+	constexpr auto BasicStringView<CharT>::split(BasicStringView<CharT> delimiter) const noexcept
+		-> BasicStringSplitRange<CharT, BasicStringView<CharT>, false>
+	{
+		return BasicStringSplitRange<CharT, BasicStringView<CharT>, false> (*this, delimiter);
+	}
+
+
+	template <typename CharT>
+	constexpr auto BasicStringView<CharT>::tokenize(CharT delimiter) const noexcept -> BasicStringSplitRange<CharT, CharT, true> {
+		return BasicStringSplitRange<CharT, CharT, true> (*this, delimiter);
+	}
+
+
+	template <typename CharT>
+	constexpr auto BasicStringView<CharT>::tokenize(BasicStringView<CharT> delimiters) const noexcept
+		-> BasicStringSplitRange<CharT, BasicStringView<CharT>, true>
+	{
+		return BasicStringSplitRange<CharT, BasicStringView<CharT>, true> (*this, delimiters);
+	}
+
+
+
+
+	template <typename CharT, typename Delimiter, bool IS_TOKENIZER>
+	constexpr BasicStringSplitRange<CharT, Delimiter, IS_TOKENIZER>::Iterator::Iterator(BasicStringView<CharT> source, Delimiter delimiter) noexcept :
+		m_current {},
+		m_next {source.getData()},
+		m_end {source.getData() + source.getSize()},
+		m_delimiter {delimiter},
+		m_isDone {false}
+	{
+		this->m_advance();
+	}
+
+
+	template <typename CharT, typename Delimiter, bool IS_TOKENIZER>
+	constexpr auto BasicStringSplitRange<CharT, Delimiter, IS_TOKENIZER>::Iterator::m_advance() noexcept -> void {
+		if constexpr (IS_TOKENIZER) {
+			const CharT *start {m_next};
+			while (start != m_end && this->m_isDelimiter(*start))
+				++start;
+			if (start == m_end) {
+				m_isDone = true;
+				return;
+			}
+
+			const CharT *tokenEnd {start + 1};
+			if constexpr (std::same_as<Delimiter, CharT>) {
+				tokenEnd = sl::utils::findChar(tokenEnd, static_cast<std::size_t> (m_end - tokenEnd), m_delimiter);
+				if (tokenEnd == nullptr)
+					tokenEnd = m_end;
+			}
+			else {
+				while (tokenEnd != m_end && !this->m_isDelimiter(*tokenEnd))
+					++tokenEnd;
+			}
+			m_current = BasicStringView<CharT> (start, static_cast<std::size_t> (tokenEnd - start));
+			m_next = tokenEnd;
+		}
+		else {
+			if (m_next == nullptr) {
+				m_isDone = true;
+				return;
+			}
+
+			const std::size_t restSize {static_cast<std::size_t> (m_end - m_next)};
+			const CharT *found {nullptr};
+			std::size_t delimiterSize {1};
+			if constexpr (std::same_as<Delimiter, CharT>)
+				found = sl::utils::findChar(m_next, restSize, m_delimiter);
+			else {
+				delimiterSize = m_delimiter.getSize();
+				// an empty delimiter never splits
+				if (delimiterSize != 0)
+					found = sl::utils::find(m_next, restSize, m_delimiter.getData(), delimiterSize);
+			}
+
+			if (found == nullptr) {
+				m_current = BasicStringView<CharT> (m_next, restSize);
+				m_next = nullptr;
+			}
+			else {
+				m_current = BasicStringView<CharT> (m_next, static_cast<std::size_t> (found - m_next));
+				m_next = found + delimiterSize;
+			}
+		}
+	}
+
+
+	template <typename CharT, typename Delimiter, bool IS_TOKENIZER>
+	constexpr auto BasicStringSplitRange<CharT, Delimiter, IS_TOKENIZER>::Iterator::m_isDelimiter(CharT character) const noexcept -> bool {
+		if constexpr (std::same_as<Delimiter, CharT>)
+			return character == m_delimiter;
+		else
+			return std::ranges::find(m_delimiter, character) != m_delimiter.end();
+	}
+
+} // namespace sl::utils
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstdint>
+
 #include "sl/core.hpp"
 #include "sl/utils/units.hpp"
 
@@ -13,8 +15,8 @@ namespace sl::utils {
 			constexpr auto operator=(const TimePoint&) noexcept -> TimePoint& = default;
 
 			constexpr auto operator-(const TimePoint &timepoint) const noexcept {
-				sl::utils::Millisecond ds {(static_cast<float> (m_seconds) - static_cast<float> (timepoint.m_seconds)) * 1000.f};
-				sl::utils::Millisecond dµs {(static_cast<float> (m_microseconds) - static_cast<float> (timepoint.m_microseconds)) * 0.001f};
+				sl::utils::Millisecond ds {static_cast<float> (static_cast<std::int64_t> (m_seconds) - static_cast<std::int64_t> (timepoint.m_seconds)) * 1000.f};
+				sl::utils::Millisecond dµs {static_cast<float> (static_cast<std::int64_t> (m_microseconds) - static_cast<std::int64_t> (timepoint.m_microseconds)) * 0.001f};
 				return ds + dµs;
 			}
 
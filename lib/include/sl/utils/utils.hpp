@@ -57,17 +57,15 @@ namespace sl::utils {
 	namespace literals {
 		constexpr auto operator ""_ver(const char *str, std::size_t N) -> Version {
 			Version version {};
-			const char *lastDot {str};
-			for (std::size_t index {0}; lastDot < str + N && index < 3; ++index, ++lastDot) {
-				const char *currentDot {std::find(lastDot, str + N, '.')};
-				sl::String stringNumber {lastDot, static_cast<std::size_t> (currentDot - lastDot)};
-				lastDot = currentDot;
-
-				std::optional<std::uint32_t> number {sl::utils::stringToNumber<std::uint32_t> (stringNumber)};
+			std::uint32_t *const parts[] {&version.major, &version.minor, &version.patch};
+			std::size_t index {0};
+			for (sl::utils::StringView part : sl::utils::StringView{str, N}.split('.')) {
+				if (index == 3)
+					break;
+				std::optional<std::uint32_t> number {sl::utils::stringToNumber<std::uint32_t> (part)};
 				if (!number)
 					throw "Invalid version string";
-
-				(&version.major)[index] = *number;
+				*parts[index++] = *number;
 			}
 			return version;
 		}
@@ -0,0 +1,195 @@
+#include "sl/memory/allocatorStats.hpp"
+
+#include <algorithm>
+#include <iostream>
+#include <mutex>
+
+
+namespace sl::memory {
+#ifdef SL_MEMORY_STATS
+	static std::mutex s_trackersMutex {};
+	static std::vector<AllocatorStatsTracker*> s_trackers {};
+
+
+	template <typename T>
+	static auto loadRelaxed(const T &field) noexcept -> T {
+		return std::atomic_ref<T> (const_cast<T&> (field)).load(std::memory_order_relaxed);
+	}
+
+	template <typename T>
+	static auto storeRelaxed(T &field, T value) noexcept -> void {
+		std::atomic_ref<T> (field).store(value, std::memory_order_relaxed);
+	}
+
+
+	static auto loadStats(const AllocatorStats &stats) noexcept -> AllocatorStats {
+		return AllocatorStats{
+			loadRelaxed(stats.usedSize),
+			loadRelaxed(stats.peakUsedSize),
+			loadRelaxed(stats.capacity),
+			loadRelaxed(stats.allocationCount),
+			loadRelaxed(stats.deallocationCount),
+			loadRelaxed(stats.failedAllocationCount),
+			loadRelaxed(stats.fragmentation)
+		};
+	}
+
+
+	static auto storeStats(AllocatorStats &destination, const AllocatorStats &source) noexcept -> void {
+		storeRelaxed(destination.usedSize, source.usedSize);
+		storeRelaxed(destination.peakUsedSize, source.peakUsedSize);
+		storeRelaxed(destination.capacity, source.capacity);
+		storeRelaxed(destination.allocationCount, source.allocationCount);
+		storeRelaxed(destination.deallocationCount, source.deallocationCount);
+		storeRelaxed(destination.failedAllocationCount, source.failedAllocationCount);
+		storeRelaxed(destination.fragmentation, source.fragmentation);
+	}
+
+
+	static auto computeFrameDelta(const AllocatorStats &stats, const AllocatorStats &frameStartStats) noexcept -> AllocatorFrameDelta {
+		return AllocatorFrameDelta{
+			static_cast<std::ptrdiff_t> (stats.usedSize) - static_cast<std::ptrdiff_t> (frameStartStats.usedSize),
+			stats.allocationCount - frameStartStats.allocationCount,
+			stats.deallocationCount - frameStartStats.deallocationCount,
+			stats.failedAllocationCount - frameStartStats.failedAllocationCount
+		};
+	}
+
+
+	AllocatorStatsTracker::AllocatorStatsTracker(std::string_view name, sl::utils::Bytes capacity) noexcept :
+		m_name {name},
+		m_stats {},
+		m_frameStartStats {},
+		m_isRegistered {false}
+	{
+		m_stats.capacity = capacity;
+		AllocatorStatsRegistry::s_registerTracker(*this);
+	}
+
+
+	AllocatorStatsTracker::~AllocatorStatsTracker() {
+		AllocatorStatsRegistry::s_unregisterTracker(*this);
+	}
+
+
+	AllocatorStatsTracker::AllocatorStatsTracker(AllocatorStatsTracker &&tracker) noexcept :
+		m_name {tracker.m_name},
+		m_stats {tracker.m_stats},
+		m_frameStartStats {},
+		m_isRegistered {false}
+	{
+		AllocatorStatsRegistry::s_replaceTracker(tracker, *this);
+	}
+
+
+	auto AllocatorStatsTracker::operator=(AllocatorStatsTracker &&tracker) noexcept -> AllocatorStatsTracker& {
+		if (this == &tracker)
+			return *this;
+		storeStats(m_stats, tracker.m_stats);
+		AllocatorStatsRegistry::s_replaceTracker(tracker, *this);
+		return *this;
+	}
+
+
+	auto AllocatorStatsTracker::getStats() const noexcept -> AllocatorStats {
+		return loadStats(m_stats);
+	}
+
+
+	auto AllocatorStatsTracker::getFrameDelta() const noexcept -> AllocatorFrameDelta {
+		// the frame start stats are written by AllocatorStatsRegistry::endFrame, from any thread
+		std::lock_guard<std::mutex> _ {s_trackersMutex};
+		return computeFrameDelta(this->getStats(), m_frameStartStats);
+	}
+#endif
+
+
+	auto AllocatorStatsRegistry::getReports() noexcept -> std::vector<AllocatorStatsReport> {
+		std::vector<AllocatorStatsReport> reports {};
+	#ifdef SL_MEMORY_STATS
+		std::lock_guard<std::mutex> _ {s_trackersMutex};
+		reports.reserve(s_trackers.size());
+		for (const AllocatorStatsTracker *tracker : s_trackers) {
+			const AllocatorStats stats {tracker->getStats()};
+			reports.emplace_back(tracker->m_name, stats, computeFrameDelta(stats, tracker->m_frameStartStats));
+		}
+	#endif
+		return reports;
+	}
+
+
+	auto AllocatorStatsRegistry::endFrame() noexcept -> void {
+	#ifdef SL_MEMORY_STATS
+		std::lock_guard<std::mutex> _ {s_trackersMutex};
+		for (AllocatorStatsTracker *tracker : s_trackers)
+			tracker->m_frameStartStats = tracker->getStats();
+	#endif
+	}
+
+
+	auto AllocatorStatsRegistry::dump() noexcept -> void {
+		dump(std::cout);
+	}
+
+
+	auto AllocatorStatsRegistry::dump(std::ostream &stream) noexcept -> void {
+		for (const auto &report : getReports()) {
+			stream << report.name << " : "
+				<< static_cast<std::size_t> (report.stats.usedSize) << " / " << static_cast<std::size_t> (report.stats.capacity) << " B used"
+				<< " (peak " << static_cast<std::size_t> (report.stats.peakUsedSize) << " B, "
+				<< std::showpos << report.frameDelta.usedSize << std::noshowpos << " B this frame), "
+				<< report.stats.allocationCount << " allocations (" << report.frameDelta.allocationCount << " this frame), "
+				<< report.stats.deallocationCount << " deallocations (" << report.frameDelta.deallocationCount << " this frame), "
+				<< report.stats.failedAllocationCount << " failed (" << report.frameDelta.failedAllocationCount << " this frame), "
+				<< "fragmentation " << report.stats.fragmentation << "\n";
+		}
+	}
+
+
+	auto AllocatorStatsRegistry::s_registerTracker([[maybe_unused]] AllocatorStatsTracker &tracker) noexcept -> void {
+	#ifdef SL_MEMORY_STATS
+		if (tracker.m_isRegistered)
+			return;
+		std::lock_guard<std::mutex> _ {s_trackersMutex};
+		s_trackers.push_back(&tracker);
+		tracker.m_isRegistered = true;
+	#endif
+	}
+
+
+	auto AllocatorStatsRegistry::s_unregisterTracker([[maybe_unused]] AllocatorStatsTracker &tracker) noexcept -> void {
+	#ifdef SL_MEMORY_STATS
+		if (!tracker.m_isRegistered)
+			return;
+		std::lock_guard<std::mutex> _ {s_trackersMutex};
+		std::erase(s_trackers, &tracker);
+		tracker.m_isRegistered = false;
+	#endif
+	}
+
+
+	auto AllocatorStatsRegistry::s_replaceTracker(
+		[[maybe_unused]] AllocatorStatsTracker &previous,
+		[[maybe_unused]] AllocatorStatsTracker &tracker
+	) noexcept -> void {
+	#ifdef SL_MEMORY_STATS
+		std::lock_guard<std::mutex> _ {s_trackersMutex};
+		tracker.m_name = previous.m_name;
+		tracker.m_frameStartStats = previous.m_frameStartStats;
+
+		const auto previousPosition {std::ranges::find(s_trackers, &previous)};
+		if (tracker.m_isRegistered) {
+			if (previousPosition != s_trackers.end())
+				(void)s_trackers.erase(previousPosition);
+		}
+		else if (previousPosition != s_trackers.end())
+			*previousPosition = &tracker;
+		else
+			s_trackers.push_back(&tracker);
+
+		previous.m_isRegistered = false;
+		tracker.m_isRegistered = true;
+	#endif
+	}
+
+} // namespace sl::memory
@@ -0,0 +1,52 @@
+#include "sl/memory/arenaScope.hpp"
+
+#include <algorithm>
+
+
+namespace sl::memory {
+	ArenaScope::ArenaScope(StackAllocator &allocator, std::pmr::memory_resource &upstream) noexcept :
+		m_allocator {&allocator},
+		m_upstream {&upstream},
+		m_marker {allocator.mark()},
+		m_overflowBlocks {},
+		m_overflowCount {0},
+		m_overflowSize {0_B}
+	{
+
+	}
+
+
+	ArenaScope::~ArenaScope() {
+		for (const auto &block : m_overflowBlocks)
+			m_upstream->deallocate(block.ptr, block.size, block.alignment);
+		m_overflowBlocks.clear();
+		m_allocator->deallocate(m_marker);
+	}
+
+
+	auto ArenaScope::do_allocate(std::size_t bytes, std::size_t alignment) -> void* {
+		if (void *ptr {m_allocator->allocate(bytes, alignment)}; ptr != nullptr)
+			return ptr;
+
+		void *ptr {m_upstream->allocate(bytes, alignment)};
+		m_overflowBlocks.emplace_back(ptr, bytes, alignment);
+		++m_overflowCount;
+		m_overflowSize += sl::utils::Bytes{bytes};
+		return ptr;
+	}
+
+
+	auto ArenaScope::do_deallocate(void *ptr, std::size_t bytes, std::size_t alignment) -> void {
+		// stack memory is only given back at the end of the scope
+		if (m_allocator->owns(reinterpret_cast<StackAllocator::const_pointer> (ptr)))
+			return;
+
+		const auto block {std::ranges::find(m_overflowBlocks, ptr, &OverflowBlock::ptr)};
+		if (block == m_overflowBlocks.end())
+			return;
+		*block = m_overflowBlocks.back();
+		m_overflowBlocks.pop_back();
+		m_upstream->deallocate(ptr, bytes, alignment);
+	}
+
+} // namespace sl::memory
@@ -0,0 +1,52 @@
+#include "sl/memory/concurrentPoolAllocator.hpp"
+
+#include <bit>
+
+
+namespace sl::memory {
+	static_assert(MAX_THREAD_SLOT_COUNT <= 64, "Thread slots are tracked by a single 64 bits mask");
+
+	static std::atomic<std::uint64_t> s_usedThreadSlots {0};
+
+
+	/*
+	 * Holds the slot of a thread from its first call to getThreadSlot to its exit
+	 */
+	class ThreadSlot final {
+		public:
+			ThreadSlot() noexcept : m_index {NO_THREAD_SLOT} {
+				std::uint64_t usedThreadSlots {s_usedThreadSlots.load(std::memory_order_relaxed)};
+				std::size_t index {};
+				do {
+					index = static_cast<std::size_t> (std::countr_one(usedThreadSlots));
+					if (index >= MAX_THREAD_SLOT_COUNT)
+						return;
+				} while (!s_usedThreadSlots.compare_exchange_weak(
+					usedThreadSlots,
+					usedThreadSlots | (static_cast<std::uint64_t> (1) << index),
+					std::memory_order_acquire,
+					std::memory_order_relaxed
+				));
+
+				m_index = index;
+			}
+
+			~ThreadSlot() {
+				if (m_index == NO_THREAD_SLOT)
+					return;
+				s_usedThreadSlots.fetch_and(~(static_cast<std::uint64_t> (1) << m_index), std::memory_order_release);
+			}
+
+			inline auto getIndex() const noexcept -> std::size_t {return m_index;}
+
+		private:
+			std::size_t m_index;
+	};
+
+
+	auto getThreadSlot() noexcept -> std::size_t {
+		thread_local const ThreadSlot threadSlot {};
+		return threadSlot.getIndex();
+	}
+
+} // namespace sl::memory
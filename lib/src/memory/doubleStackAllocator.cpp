@@ -7,20 +7,15 @@ namespace sl::memory {
 		m_stackBase {reinterpret_cast<pointer> (std::malloc(m_stackSize))},
 		m_topStackTop {m_stackBase + size},
 		m_bottomStackTop {m_stackBase},
-		m_isTopStackActive {false}
+		m_isTopStackActive {false},
+		m_stats {"DoubleStackAllocator", m_stackSize}
 	{
 
 	}
 
 
 	DoubleStackAllocator::~DoubleStackAllocator() {
-		if (m_stackBase != nullptr)
-			std::free(m_stackBase);
-		m_stackSize = 0_B;
-		m_bottomStackTop = nullptr;
-		m_topStackTop = nullptr;
-		m_stackBase = nullptr;
-		m_isTopStackActive = false;
+		this->m_release();
 	}
 
 
@@ -29,7 +24,8 @@ namespace sl::memory {
 		m_stackBase {allocator.m_stackBase},
 		m_topStackTop {allocator.m_topStackTop},
 		m_bottomStackTop {allocator.m_bottomStackTop},
-		m_isTopStackActive {allocator.m_isTopStackActive}
+		m_isTopStackActive {allocator.m_isTopStackActive},
+		m_stats {std::move(allocator.m_stats)}
 	{
 		allocator.m_stackSize = 0_B;
 		allocator.m_stackBase = nullptr;
@@ -40,13 +36,16 @@ namespace sl::memory {
 
 
 	auto DoubleStackAllocator::operator=(DoubleStackAllocator &&allocator) noexcept -> DoubleStackAllocator& {
-		this->~DoubleStackAllocator();
+		if (this == &allocator)
+			return *this;
+		this->m_release();
 
 		m_stackSize = allocator.m_stackSize;
 		m_stackBase = allocator.m_stackBase;
 		m_topStackTop = allocator.m_topStackTop;
 		m_bottomStackTop = allocator.m_bottomStackTop;
 		m_isTopStackActive = allocator.m_isTopStackActive;
+		m_stats = std::move(allocator.m_stats);
 
 		allocator.m_stackSize = 0_B;
 		allocator.m_stackBase = nullptr;
@@ -59,15 +58,22 @@ namespace sl::memory {
 
 
 	[[nodiscard]]
-	auto DoubleStackAllocator::allocate(size_type size, size_type alignment) noexcept -> pointer {
-		if (m_isTopStackActive) {
-			pointer tmpStackTop {m_topStackTop};
-			tmpStackTop -= reinterpret_cast<size_type> (tmpStackTop) % alignment;
+	auto DoubleStackAllocator::allocate(size_type size, size_type alignment, DoubleStackSide side) noexcept -> pointer {
+		if (side == DoubleStackSide::eTop) {
+			if (static_cast<size_type> (m_topStackTop - m_bottomStackTop) < size) {
+				m_stats.onFailedAllocation();
+				return nullptr;
+			}
 
-			if ((tmpStackTop - size) - m_bottomStackTop < 0)
+			pointer tmpStackTop {m_topStackTop - size};
+			tmpStackTop -= reinterpret_cast<size_type> (tmpStackTop) % alignment;
+			if (tmpStackTop < m_bottomStackTop) {
+				m_stats.onFailedAllocation();
 				return nullptr;
+			}
 
-			m_topStackTop = tmpStackTop - size;
+			m_stats.onAllocation(static_cast<size_type> (m_topStackTop - tmpStackTop));
+			m_topStackTop = tmpStackTop;
 			return tmpStackTop;
 		}
 
@@ -75,25 +81,36 @@ namespace sl::memory {
 		if (reinterpret_cast<size_type> (tmpStackTop) % alignment != 0)
 			tmpStackTop += alignment - (reinterpret_cast<size_type> (tmpStackTop) % alignment);
 
-		if (m_topStackTop - (tmpStackTop + size) < 0)
+		if (m_topStackTop - (tmpStackTop + size) < 0) {
+			m_stats.onFailedAllocation();
 			return nullptr;
+		}
 
+		m_stats.onAllocation(static_cast<size_type> (tmpStackTop + size - m_bottomStackTop));
 		m_bottomStackTop = tmpStackTop + size;
 		return tmpStackTop;
 	}
 
 
 	[[nodiscard]]
-	auto DoubleStackAllocator::mark() const noexcept -> Marker {
-		return DoubleStackAllocatorMarker(m_isTopStackActive ? m_topStackTop : m_bottomStackTop, m_isTopStackActive);
+	auto DoubleStackAllocator::mark(DoubleStackSide side) const noexcept -> Marker {
+		if (side == DoubleStackSide::eTop)
+			return DoubleStackAllocatorMarker(m_topStackTop, true);
+		return DoubleStackAllocatorMarker(m_bottomStackTop, false);
 	}
 
 
 	auto DoubleStackAllocator::deallocate(Marker marker) noexcept -> void {
-		if (marker.m_isFromTopStack)
+		if (marker.m_isFromTopStack) {
+			if (marker.m_marker > m_topStackTop)
+				m_stats.onDeallocation(static_cast<size_type> (marker.m_marker - m_topStackTop));
 			m_topStackTop = marker.m_marker;
-		else
+		}
+		else {
+			if (marker.m_marker < m_bottomStackTop)
+				m_stats.onDeallocation(static_cast<size_type> (m_bottomStackTop - marker.m_marker));
 			m_bottomStackTop = marker.m_marker;
+		}
 	}
 
 
@@ -101,4 +118,15 @@ namespace sl::memory {
 		m_isTopStackActive = !m_isTopStackActive;
 	}
 
+
+	auto DoubleStackAllocator::m_release() noexcept -> void {
+		if (m_stackBase != nullptr)
+			std::free(m_stackBase);
+		m_stackSize = 0_B;
+		m_bottomStackTop = nullptr;
+		m_topStackTop = nullptr;
+		m_stackBase = nullptr;
+		m_isTopStackActive = false;
+	}
+
 } // namespace sl::memory
@@ -0,0 +1,57 @@
+#include "sl/memory/frameAllocator.hpp"
+
+#include <algorithm>
+
+#include "sl/utils/assert.hpp"
+
+
+namespace sl::memory {
+	FrameAllocator::FrameAllocator(const FrameAllocatorCreateInfos &createInfos) noexcept :
+		m_frames {},
+		m_currentFrame {0},
+		m_lastFramePeakUsage {0_B},
+		m_peakUsage {0_B}
+	{
+		SL_TEXT_ASSERT(createInfos.frameCount != 0, "FrameAllocator needs at least one frame");
+		m_frames.reserve(createInfos.frameCount);
+		for (size_type i {0}; i < createInfos.frameCount; ++i)
+			m_frames.emplace_back(sl::memory::StackAllocator(createInfos.arena), 0, false, 0_B);
+	}
+
+
+	[[nodiscard]]
+	auto FrameAllocator::allocate(size_type size, size_type alignment) noexcept -> pointer {
+		Frame &frame {m_frames[m_currentFrame]};
+		if (frame.isInFlight)
+			return nullptr;
+
+		pointer ptr {frame.arena.allocate(size, alignment)};
+		frame.peakUsage = std::max(frame.peakUsage, frame.arena.getUsedSize());
+		return ptr;
+	}
+
+
+	auto FrameAllocator::endFrame(CompletionToken retireToken) noexcept -> void {
+		Frame &frame {m_frames[m_currentFrame]};
+		SL_TEXT_ASSERT(!frame.isInFlight, "Can't end a FrameAllocator frame that is already in flight");
+
+		frame.isInFlight = true;
+		frame.retireToken = retireToken;
+		m_lastFramePeakUsage = frame.peakUsage;
+		m_peakUsage = std::max(m_peakUsage, frame.peakUsage);
+		m_currentFrame = (m_currentFrame + 1) % m_frames.size();
+	}
+
+
+	auto FrameAllocator::signalCompletion(CompletionToken completedToken) noexcept -> void {
+		for (auto &frame : m_frames) {
+			if (!frame.isInFlight || frame.retireToken > completedToken)
+				continue;
+
+			frame.arena.clear();
+			frame.isInFlight = false;
+			frame.peakUsage = 0_B;
+		}
+	}
+
+} // namespace sl::memory
@@ -14,6 +14,7 @@ namespace sl::memory::gpu {
 		m_cpuVisible = createInfos.cpuVisible;
 		m_size = createInfos.size;
 		m_allocations.reserve(m_size / createInfos.averageAllocationSize);
+		m_stats.setCapacity(m_size);
 
 		VkPhysicalDeviceMemoryProperties physicalDeviceMemoryProperties {};
 		vkGetPhysicalDeviceMemoryProperties(m_gpu->getPhysicalDevice(), &physicalDeviceMemoryProperties);
@@ -62,9 +63,12 @@ namespace sl::memory::gpu {
 			lastEndPosition = allocation->position + allocation->size;
 		}
 
-		if (m_size - lastEndPosition < size)
+		if (m_size - lastEndPosition < size) {
+			m_stats.onFailedAllocation();
 			return std::nullopt;
+		}
 
+		m_stats.onAllocation(size);
 		allocation = m_allocations.insert(allocation, {lastEndPosition, size});
 		return allocation->position + 1;
 	}
@@ -75,6 +79,7 @@ namespace sl::memory::gpu {
 		for (auto it {m_allocations.begin()}; it != m_allocations.end() && it->position <= position; ++it) {
 			if (it->position != position)
 				continue;
+			m_stats.onDeallocation(it->size);
 			m_allocations.erase(it);
 			return;
 		}
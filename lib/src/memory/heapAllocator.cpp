@@ -1,31 +1,44 @@
 #include "sl/memory/heapAllocator.hpp"
 
+#include <algorithm>
+#include <bit>
+#include <cstring>
+
 #include "sl/utils/logger.hpp"
+#include "sl/utils/time.hpp"
 
 
 namespace sl::memory {
-	HeapAllocator::HeapAllocator(sl::utils::Bytes pageSize, size_type maxPageCount, sl::utils::Bytes averageAllocationSize) noexcept :
+	HeapAllocator::HeapAllocator(
+		sl::utils::Bytes pageSize,
+		size_type maxPageCount,
+		sl::utils::Bytes averageAllocationSize,
+		const sl::memory::PageProviderCreateInfos &pageProvider
+	) noexcept :
 		m_pageSize {pageSize},
-		m_pageCount {1},
+		m_pageCount {0},
 		m_maxPageCount {maxPageCount},
 		m_maxAllocationPageSize {m_pageSize / averageAllocationSize},
+		m_addressIndexBucketSizeLog2 {static_cast<size_type> (std::bit_width(
+			std::max<size_type> (averageAllocationSize * ADDRESS_INDEX_BUCKET_ALLOCATION_COUNT, 2) - 1
+		))},
+		m_pageProvider {pageProvider},
 		m_pages {m_maxPageCount},
-		m_pTable {m_maxPageCount * m_maxAllocationPageSize},
-		m_allocationPages {m_maxPageCount}
+		m_pTable {
+			std::max<size_type> (std::min<size_type> (m_maxAllocationPageSize, MAX_PTABLE_CHUNK_SIZE), 1),
+			sl::memory::PoolAllocator<Allocation>::UNLIMITED_CHUNK_COUNT
+		},
+		m_firstPage {nullptr},
+		m_lastPage {nullptr},
+		m_defragmentationCursor {nullptr},
+		m_stats {"HeapAllocator"}
 	{
-		*m_pages.allocate() = new value_type[m_pageSize];
-		std::vector<Allocation> *allocationPage {m_allocationPages.allocate()};
-		new (allocationPage) std::vector<Allocation> ();
-		allocationPage->reserve(m_maxAllocationPageSize);
+		(void)this->m_createPage();
 	}
 
 
 	HeapAllocator::~HeapAllocator() {
-		for (auto &allocationPage : m_allocationPages)
-			allocationPage.~vector<Allocation> ();
-
-		for (const auto &page : m_pages)
-			delete[] page;
+		this->m_release();
 	}
 
 
@@ -34,32 +47,50 @@ namespace sl::memory {
 		m_pageCount {allocator.m_pageCount},
 		m_maxPageCount {allocator.m_maxPageCount},
 		m_maxAllocationPageSize {allocator.m_maxAllocationPageSize},
+		m_addressIndexBucketSizeLog2 {allocator.m_addressIndexBucketSizeLog2},
+		m_pageProvider {allocator.m_pageProvider},
 		m_pages {std::move(allocator.m_pages)},
 		m_pTable {std::move(allocator.m_pTable)},
-		m_allocationPages {std::move(allocator.m_allocationPages)}
+		m_firstPage {allocator.m_firstPage},
+		m_lastPage {allocator.m_lastPage},
+		m_defragmentationCursor {allocator.m_defragmentationCursor},
+		m_stats {std::move(allocator.m_stats)}
 	{
 		allocator.m_pageSize = 0_B;
 		allocator.m_pageCount = 0;
 		allocator.m_maxPageCount = 0;
 		allocator.m_maxAllocationPageSize = 0_B;
+		allocator.m_firstPage = nullptr;
+		allocator.m_lastPage = nullptr;
+		allocator.m_defragmentationCursor = nullptr;
 	}
 
 
 	auto HeapAllocator::operator=(HeapAllocator &&allocator) noexcept -> HeapAllocator& {
-		this->~HeapAllocator();
+		if (this == &allocator)
+			return *this;
+		this->m_release();
 
 		m_pageSize = allocator.m_pageSize;
 		m_pageCount = allocator.m_pageCount;
 		m_maxPageCount = allocator.m_maxPageCount;
 		m_maxAllocationPageSize = allocator.m_maxAllocationPageSize;
+		m_addressIndexBucketSizeLog2 = allocator.m_addressIndexBucketSizeLog2;
+		m_pageProvider = allocator.m_pageProvider;
 		m_pages = std::move(allocator.m_pages);
 		m_pTable = std::move(allocator.m_pTable);
-		m_allocationPages = std::move(allocator.m_allocationPages);
+		m_firstPage = allocator.m_firstPage;
+		m_lastPage = allocator.m_lastPage;
+		m_defragmentationCursor = allocator.m_defragmentationCursor;
+		m_stats = std::move(allocator.m_stats);
 
 		allocator.m_pageSize = 0_B;
 		allocator.m_pageCount = 0;
 		allocator.m_maxPageCount = 0;
 		allocator.m_maxAllocationPageSize = 0_B;
+		allocator.m_firstPage = nullptr;
+		allocator.m_lastPage = nullptr;
+		allocator.m_defragmentationCursor = nullptr;
 
 		return *this;
 	}
@@ -68,96 +99,183 @@ namespace sl::memory {
 	auto HeapAllocator::allocate(size_type size, size_type alignment) noexcept -> HeapAllocator::pointer {
 		SL_TEXT_ASSERT(size <= m_pageSize, "Can't allocate more memory at once that what a page of HeapAllocator can contain");
 
-		auto page {m_pages.begin()};
-		decltype(m_allocationPages.begin()->begin()) allocationPosition {};
-		auto allocationPage {m_allocationPages.begin()};
-		value_type *address {nullptr};
-
-		for (; page != m_pages.end(); ++page, ++allocationPage) {
-			auto emptySpot {s_findEmptySpot(*page, m_pageSize, *allocationPage, size, alignment)};
-			if (!emptySpot)
-				continue;
+		// worst case padding needed to align the start of any free range big enough
+		const size_type searchSize {size + alignment - 1};
+		Allocation *owner {nullptr};
 
-			allocationPosition = emptySpot.value().first;
-			address = emptySpot.value().second;
-			break;
-		}
+		for (Page *page {m_firstPage}; page != nullptr && owner == nullptr; page = page->nextPage)
+			owner = s_findFreeRange(*page, searchSize);
 
-		if (page == m_pages.end()) {
-			if (m_pageCount >= m_maxPageCount)
+		if (owner == nullptr) {
+			Page *page {searchSize <= m_pageSize ? this->m_createPage() : nullptr};
+			if (page == nullptr) {
+				m_stats.onFailedAllocation();
 				return nullptr;
+			}
+			owner = &page->head;
+		}
 
-			page = m_pages.allocateIt();
-			*page = new value_type[m_pageSize];
-			allocationPage = m_allocationPages.allocateIt();
-			allocationPage->reserve(m_maxAllocationPageSize);
-			allocationPosition = allocationPage->end();
-			address = s_alignToAlignment(*page, alignment);
+		Allocation *allocation {m_pTable.allocate()};
+		if (allocation == nullptr) {
+			m_stats.onFailedAllocation();
+			return nullptr;
 		}
 
-		value_type **pTableEntry {m_pTable.allocate()};
-		*pTableEntry = address;
-		allocationPage->insert(allocationPosition, Allocation{pTableEntry, size, alignment});
+		value_type *ownerEnd {owner->start + owner->size};
+		value_type *freeRangeEnd {ownerEnd + owner->freeSize};
+		value_type *address {s_alignToAlignment(ownerEnd, alignment)};
+
+		s_removeFreeRange(*owner);
+		owner->freeSize = static_cast<size_type> (address - ownerEnd);
+		*allocation = Allocation{
+			address,
+			size,
+			alignment,
+			static_cast<size_type> (freeRangeEnd - (address + size)),
+			owner->page,
+			nullptr, nullptr, nullptr, nullptr
+		};
+		s_linkAllocation(*owner, *allocation);
+		s_insertFreeRange(*owner);
+		s_insertFreeRange(*allocation);
+		this->m_insertInAddressIndex(*allocation);
+		m_stats.onAllocation(size);
 
-		return pointer(pTableEntry);
+		return pointer(&allocation->start);
 	}
 
 
 	auto HeapAllocator::deallocate(const pointer &ptr) noexcept -> void {
-		for (auto it {m_pTable.begin()}; it != m_pTable.end(); ++it) {
-			if (&*it != ptr.m_pTableEntry)
-				continue;
-			m_pTable.deallocate(&*it);
-			break;
-		}
-
-		for (auto &allocationPage : m_allocationPages) {
-			for (auto it {allocationPage.begin()}; it != allocationPage.end(); ++it) {
-				if (it->start != ptr.m_pTableEntry)
-					continue;
-				allocationPage.erase(it);
-				return;
-			}
-		}
+		Allocation *allocation {s_getAllocation(ptr)};
+		if (allocation == nullptr)
+			return;
+
+		SL_TEXT_ASSERT(allocation->page != nullptr, "Can't deallocate a HeapAllocator handle that was already deallocated");
+		Allocation &previous {*allocation->previous};
+		if (m_defragmentationCursor == allocation)
+			m_defragmentationCursor = &previous;
+
+		s_removeFreeRange(previous);
+		s_removeFreeRange(*allocation);
+		previous.freeSize += allocation->size + allocation->freeSize;
+		this->m_removeFromAddressIndex(*allocation);
+		s_unlinkAllocation(*allocation);
+		s_insertFreeRange(previous);
+
+		m_stats.onDeallocation(allocation->size);
+		allocation->page = nullptr;
+		m_pTable.deallocate(allocation);
 	}
 
 
-	auto HeapAllocator::defragment(size_type maxRelocationCount) noexcept -> void {
-		size_type relocationCount {0};
+	auto HeapAllocator::defragment(const HeapDefragmentationBudget &budget) noexcept -> HeapDefragmentationReport {
+		// how many allocations are visited between two checks of the time budget when nothing moves
+		constexpr size_type TIME_CHECK_PERIOD {256};
+
+		HeapDefragmentationReport report {};
+		// no page exists when the allocator was moved from, or when its first page couldn't be created
+		if (m_firstPage == nullptr)
+			return report;
+
+		const sl::utils::TimePoint startTime {sl::utils::TimePoint::now()};
+		const auto isTimeBudgetExhausted = [&budget, &startTime]() -> bool {
+			return sl::utils::TimePoint::now() - startTime >= budget.time;
+		};
 
-		auto page {m_pages.begin()};
-		auto allocationPage {m_allocationPages.begin()};
+		if (m_defragmentationCursor == nullptr)
+			m_defragmentationCursor = &m_firstPage->head;
 
-		for (; page != m_pages.end(); ++page, ++allocationPage) {
-			value_type *lastAllocationEnd {*page};
+		// the starting page is visited twice, so that the part before the cursor is defragmented too
+		size_type remainingPageCount {m_pageCount + 1};
+		size_type visitedAllocationCount {0};
 
-			for (auto &allocation : *allocationPage) {
-				if (relocationCount >= maxRelocationCount)
-					return;
+		while (remainingPageCount != 0) {
+			Allocation *allocation {m_defragmentationCursor->next};
 
-				size_type offset {static_cast<size_type> (*allocation.start - lastAllocationEnd)};
-				if (offset < allocation.alignment) {
-					lastAllocationEnd = *allocation.start + allocation.size;
-					continue;
+			if (allocation == nullptr) {
+				Page &page {*m_defragmentationCursor->page};
+				Page *nextPage {page.nextPage != nullptr ? page.nextPage : m_firstPage};
+				if (page.head.next == nullptr && m_pageCount > 1) {
+					this->m_releasePage(page);
+					++report.releasedPageCount;
 				}
 
-				value_type *newAddress {s_alignToAlignment(lastAllocationEnd, allocation.alignment)};
-				(void)std::memmove(newAddress, *allocation.start, allocation.size);
-				*allocation.start = newAddress;
-				lastAllocationEnd = *allocation.start + allocation.size;
-				++relocationCount;
+				m_defragmentationCursor = &nextPage->head;
+				--remainingPageCount;
+				continue;
+			}
+
+			if (++visitedAllocationCount % TIME_CHECK_PERIOD == 0 && isTimeBudgetExhausted())
+				break;
+
+			if (allocation->previous->freeSize >= allocation->alignment) {
+				if (report.relocationCount >= budget.maxRelocationCount)
+					break;
+				// a single allocation bigger than the whole budget still gets relocated, so that the defragmentation can progress
+				if (report.relocationCount != 0 && report.relocatedSize + sl::utils::Bytes(allocation->size) > budget.size)
+					break;
+				if (isTimeBudgetExhausted())
+					break;
+
+				this->m_removeFromAddressIndex(*allocation);
+				(void)s_relocate(*allocation);
+				this->m_insertInAddressIndex(*allocation);
+				++report.relocationCount;
+				report.relocatedSize += sl::utils::Bytes(allocation->size);
 			}
+
+			m_defragmentationCursor = allocation;
+		}
+
+		report.isPassComplete = remainingPageCount == 0;
+		if (!budget.measureFragmentation)
+			return report;
+
+		report.fragmentation = this->getFragmentation();
+		if (report.fragmentation.freeSize != 0_B) {
+			m_stats.setFragmentation(1.f
+				- static_cast<float> (report.fragmentation.largestFreeRange) / static_cast<float> (report.fragmentation.freeSize)
+			);
 		}
+		return report;
 	}
 
 
-	auto HeapAllocator::findInPTable(std::byte *ptr) noexcept -> pointer {
-		for (auto &pTableEntry : m_pTable) {
-			if (pTableEntry != ptr)
-				continue;
-			return pointer(&pTableEntry);
+	auto HeapAllocator::getFragmentation() const noexcept -> HeapFragmentation {
+		HeapFragmentation fragmentation {};
+		fragmentation.pages.reserve(m_pageCount);
+
+		for (const Page *page {m_firstPage}; page != nullptr; page = page->nextPage) {
+			HeapPageFragmentation &pageFragmentation {fragmentation.pages.emplace_back()};
+			pageFragmentation.freeSize = page->freeSize;
+			pageFragmentation.largestFreeRange = s_getLargestFreeRange(*page);
+			pageFragmentation.freeRatio = static_cast<float> (page->freeSize) / static_cast<float> (m_pageSize);
+
+			fragmentation.freeSize += pageFragmentation.freeSize;
+			fragmentation.largestFreeRange = std::max(fragmentation.largestFreeRange, pageFragmentation.largestFreeRange);
 		}
 
+		if (m_pageCount != 0)
+			fragmentation.freeRatio = static_cast<float> (fragmentation.freeSize) / static_cast<float> (m_pageSize * m_pageCount);
+		return fragmentation;
+	}
+
+
+	auto HeapAllocator::findInPTable(std::byte *ptr) noexcept -> pointer {
+		Page *page {m_firstPage};
+		while (page != nullptr && (ptr < page->memory || ptr > page->memory + m_pageSize))
+			page = page->nextPage;
+		if (page == nullptr)
+			return nullptr;
+
+		// allocations are chained in address order, so the walk stops at the first one past `ptr`
+		for (Allocation *allocation {page->addressIndex[this->m_getAddressIndexBucket(*page, ptr)]};
+			allocation != nullptr && allocation->start <= ptr;
+			allocation = allocation->next
+		) {
+			if (allocation->start == ptr)
+				return pointer(&allocation->start);
+		}
 		return nullptr;
 	}
 
@@ -169,32 +287,251 @@ namespace sl::memory {
 	}
 
 
-	auto HeapAllocator::s_findEmptySpot(
-		value_type *page,
-		size_type pageSize,
-		std::vector<Allocation> &allocations,
-		size_type size,
-		size_type alignment
-	) noexcept -> std::optional<std::pair<decltype(allocations.begin()), value_type*>> {
-		const auto isSpotValid = [alignment, size](value_type *lastEnd, value_type *start) -> bool {
-			lastEnd = s_alignToAlignment(lastEnd, alignment);
-			return start - lastEnd >= static_cast<std::ptrdiff_t> (size);
+	auto HeapAllocator::s_getAllocation(const pointer &ptr) noexcept -> Allocation* {
+		return reinterpret_cast<Allocation*> (ptr.m_pTableEntry);
+	}
+
+
+	auto HeapAllocator::s_initPage(Page &page, value_type *memory, size_type pageSize, Allocation **addressIndex) noexcept -> void {
+		page.memory = memory;
+		page.previousPage = nullptr;
+		page.nextPage = nullptr;
+		page.freeSize = 0;
+		page.addressIndex = addressIndex;
+		page.head = Allocation{memory, 0, 1, pageSize, &page, nullptr, nullptr, nullptr, nullptr};
+		page.firstLevelBitmap = 0;
+		std::ranges::fill(page.secondLevelBitmaps, 0);
+		for (auto &freeLists : page.freeLists)
+			std::ranges::fill(freeLists, nullptr);
+		s_insertFreeRange(page.head);
+	}
+
+
+	auto HeapAllocator::s_mapFreeSize(size_type size) noexcept -> std::pair<size_type, size_type> {
+		if (size < SECOND_LEVEL_COUNT)
+			return {0, size};
+
+		const size_type mostSignificantBit {static_cast<size_type> (std::bit_width(size)) - 1};
+		return {
+			mostSignificantBit - SECOND_LEVEL_INDEX_LOG2 + 1,
+			(size >> (mostSignificantBit - SECOND_LEVEL_INDEX_LOG2)) ^ SECOND_LEVEL_COUNT
 		};
+	}
+
+
+	auto HeapAllocator::s_insertFreeRange(Allocation &allocation) noexcept -> void {
+		if (allocation.freeSize == 0)
+			return;
+
+		Page &page {*allocation.page};
+		const auto [firstLevel, secondLevel] {s_mapFreeSize(allocation.freeSize)};
+		Allocation *&list {page.freeLists[firstLevel][secondLevel]};
+		page.freeSize += allocation.freeSize;
+
+		allocation.previousFree = nullptr;
+		allocation.nextFree = list;
+		if (list != nullptr)
+			list->previousFree = &allocation;
+		list = &allocation;
+
+		page.firstLevelBitmap |= static_cast<std::uint64_t> (1) << firstLevel;
+		page.secondLevelBitmaps[firstLevel] |= static_cast<std::uint32_t> (1) << secondLevel;
+	}
+
+
+	auto HeapAllocator::s_removeFreeRange(Allocation &allocation) noexcept -> void {
+		if (allocation.freeSize == 0)
+			return;
+
+		Page &page {*allocation.page};
+		const auto [firstLevel, secondLevel] {s_mapFreeSize(allocation.freeSize)};
+		page.freeSize -= allocation.freeSize;
+
+		if (allocation.nextFree != nullptr)
+			allocation.nextFree->previousFree = allocation.previousFree;
+		if (allocation.previousFree != nullptr)
+			allocation.previousFree->nextFree = allocation.nextFree;
+		else {
+			page.freeLists[firstLevel][secondLevel] = allocation.nextFree;
+			if (allocation.nextFree == nullptr) {
+				page.secondLevelBitmaps[firstLevel] &= ~(static_cast<std::uint32_t> (1) << secondLevel);
+				if (page.secondLevelBitmaps[firstLevel] == 0)
+					page.firstLevelBitmap &= ~(static_cast<std::uint64_t> (1) << firstLevel);
+			}
+		}
+
+		allocation.previousFree = nullptr;
+		allocation.nextFree = nullptr;
+	}
+
+
+	auto HeapAllocator::s_findFreeRange(const Page &page, size_type size) noexcept -> Allocation* {
+		// round the size up to the next list boundary, so that any range of the found list is big enough
+		if (size >= SECOND_LEVEL_COUNT)
+			size += (static_cast<size_type> (1) << (std::bit_width(size) - 1 - SECOND_LEVEL_INDEX_LOG2)) - 1;
+
+		auto [firstLevel, secondLevel] {s_mapFreeSize(size)};
+		if (firstLevel >= FIRST_LEVEL_COUNT)
+			return nullptr;
+
+		std::uint32_t secondLevelMap {page.secondLevelBitmaps[firstLevel] & (~static_cast<std::uint32_t> (0) << secondLevel)};
+		if (secondLevelMap == 0) {
+			if (firstLevel + 1 >= FIRST_LEVEL_COUNT)
+				return nullptr;
+			const std::uint64_t firstLevelMap {page.firstLevelBitmap & (~static_cast<std::uint64_t> (0) << (firstLevel + 1))};
+			if (firstLevelMap == 0)
+				return nullptr;
+
+			firstLevel = static_cast<size_type> (std::countr_zero(firstLevelMap));
+			secondLevelMap = page.secondLevelBitmaps[firstLevel];
+		}
+
+		secondLevel = static_cast<size_type> (std::countr_zero(secondLevelMap));
+		return page.freeLists[firstLevel][secondLevel];
+	}
+
+
+	auto HeapAllocator::s_getLargestFreeRange(const Page &page) noexcept -> size_type {
+		if (page.firstLevelBitmap == 0)
+			return 0;
+
+		const size_type firstLevel {static_cast<size_type> (std::bit_width(page.firstLevelBitmap)) - 1};
+		const size_type secondLevel {static_cast<size_type> (std::bit_width(page.secondLevelBitmaps[firstLevel])) - 1};
+		size_type largestFreeRange {0};
+		for (const Allocation *allocation {page.freeLists[firstLevel][secondLevel]}; allocation != nullptr; allocation = allocation->nextFree)
+			largestFreeRange = std::max(largestFreeRange, allocation->freeSize);
+		return largestFreeRange;
+	}
+
+
+	auto HeapAllocator::s_linkAllocation(Allocation &previous, Allocation &allocation) noexcept -> void {
+		allocation.previous = &previous;
+		allocation.next = previous.next;
+		if (previous.next != nullptr)
+			previous.next->previous = &allocation;
+		previous.next = &allocation;
+	}
+
+
+	auto HeapAllocator::s_unlinkAllocation(Allocation &allocation) noexcept -> void {
+		allocation.previous->next = allocation.next;
+		if (allocation.next != nullptr)
+			allocation.next->previous = allocation.previous;
+
+		allocation.previous = nullptr;
+		allocation.next = nullptr;
+	}
+
+
+	auto HeapAllocator::s_relocate(Allocation &allocation) noexcept -> size_type {
+		Allocation &previous {*allocation.previous};
+		value_type *newAddress {s_alignToAlignment(previous.start + previous.size, allocation.alignment)};
+		size_type relocationDistance {static_cast<size_type> (allocation.start - newAddress)};
+
+		s_removeFreeRange(previous);
+		s_removeFreeRange(allocation);
+		(void)std::memmove(newAddress, allocation.start, allocation.size);
+		allocation.start = newAddress;
+		previous.freeSize -= relocationDistance;
+		allocation.freeSize += relocationDistance;
+		s_insertFreeRange(previous);
+		s_insertFreeRange(allocation);
+		return relocationDistance;
+	}
+
+
+	auto HeapAllocator::m_insertInAddressIndex(Allocation &allocation) noexcept -> void {
+		Page &page {*allocation.page};
+		const size_type bucket {this->m_getAddressIndexBucket(page, allocation.start)};
+		// the first allocation of its bucket is the one whose predecessor starts in an earlier bucket
+		const Allocation &previous {*allocation.previous};
+		if (&previous == &page.head || this->m_getAddressIndexBucket(page, previous.start) != bucket)
+			page.addressIndex[bucket] = &allocation;
+	}
+
+
+	auto HeapAllocator::m_removeFromAddressIndex(Allocation &allocation) noexcept -> void {
+		Page &page {*allocation.page};
+		const size_type bucket {this->m_getAddressIndexBucket(page, allocation.start)};
+		if (page.addressIndex[bucket] != &allocation)
+			return;
+
+		const Allocation *next {allocation.next};
+		page.addressIndex[bucket] = next != nullptr && this->m_getAddressIndexBucket(page, next->start) == bucket ? allocation.next : nullptr;
+	}
+
 
-		value_type *lastEnd {page};
+	auto HeapAllocator::m_createPage() noexcept -> Page* {
+		if (m_pageCount >= m_maxPageCount)
+			return nullptr;
 
-		for (auto it {allocations.begin()}; it != allocations.end(); ++it) {
-			value_type *start {*it->start};
-			value_type *end {start + it->size};
+		Page *page {m_pages.allocate()};
+		if (page == nullptr)
+			return nullptr;
 
-			if (isSpotValid(lastEnd, start))
-				return std::make_optional(std::make_pair(it, s_alignToAlignment(lastEnd, alignment)));
-			lastEnd = end;
+		value_type *memory {m_pageProvider.allocate(this->m_getPageMemorySize())};
+		if (memory == nullptr) {
+			m_pages.deallocate(page);
+			return nullptr;
+		}
+
+		Allocation **addressIndex {reinterpret_cast<Allocation**> (memory + this->m_getAddressIndexOffset())};
+		std::ranges::fill_n(addressIndex, static_cast<difference_type> ((static_cast<size_type> (m_pageSize) >> m_addressIndexBucketSizeLog2) + 1), nullptr);
+		s_initPage(*page, memory, m_pageSize, addressIndex);
+		page->previousPage = m_lastPage;
+		if (m_lastPage == nullptr)
+			m_firstPage = page;
+		else
+			m_lastPage->nextPage = page;
+		m_lastPage = page;
+		++m_pageCount;
+		m_stats.setCapacity(m_pageSize * m_pageCount);
+		return page;
+	}
+
+
+	auto HeapAllocator::m_releasePage(Page &page) noexcept -> void {
+		SL_TEXT_ASSERT(page.head.next == nullptr, "Can't release a HeapAllocator page that still holds allocations");
+
+		if (m_defragmentationCursor != nullptr && m_defragmentationCursor->page == &page)
+			m_defragmentationCursor = nullptr;
+
+		if (page.previousPage == nullptr)
+			m_firstPage = page.nextPage;
+		else
+			page.previousPage->nextPage = page.nextPage;
+		if (page.nextPage == nullptr)
+			m_lastPage = page.previousPage;
+		else
+			page.nextPage->previousPage = page.previousPage;
+
+		m_pageProvider.deallocate(page.memory, this->m_getPageMemorySize());
+		m_pages.deallocate(&page);
+		--m_pageCount;
+		m_stats.setCapacity(m_pageSize * m_pageCount);
+	}
+
+
+	auto HeapAllocator::m_release() noexcept -> void {
+		Page *page {m_firstPage};
+		while (page != nullptr) {
+			Page *nextPage {page->nextPage};
+			for (Allocation *allocation {page->head.next}; allocation != nullptr;) {
+				Allocation *nextAllocation {allocation->next};
+				m_stats.onDeallocation(allocation->size);
+				m_pTable.deallocate(allocation);
+				allocation = nextAllocation;
+			}
+			m_pageProvider.deallocate(page->memory, this->m_getPageMemorySize());
+			m_pages.deallocate(page);
+			page = nextPage;
 		}
 
-		if (isSpotValid(lastEnd, page + pageSize))
-			return std::make_optional(std::make_pair(allocations.end(), s_alignToAlignment(lastEnd, alignment)));
-		return std::nullopt;
+		m_pageCount = 0;
+		m_firstPage = nullptr;
+		m_lastPage = nullptr;
+		m_defragmentationCursor = nullptr;
+		m_stats.setCapacity(0_B);
 	}
 
 } // namespace sl::memory
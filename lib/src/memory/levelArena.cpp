@@ -0,0 +1,56 @@
+#include "sl/memory/levelArena.hpp"
+
+#include <cstring>
+
+
+namespace sl::memory {
+	LevelArena::LevelArena(sl::utils::Bytes size) noexcept :
+		m_allocator {size},
+		m_persistentStart {m_allocator.mark(DoubleStackSide::eBottom)},
+		m_scratchStart {m_allocator.mark(DoubleStackSide::eTop)},
+		m_persistentResource {*this, DoubleStackSide::eBottom},
+		m_scratchResource {*this, DoubleStackSide::eTop},
+		m_collisionCallback {},
+		m_collisionCount {0},
+		m_lastCollision {}
+	{
+
+	}
+
+
+	[[nodiscard]]
+	auto LevelArena::allocatePersistent(size_type size, size_type alignment) noexcept -> pointer {
+		return this->m_allocate(size, alignment, DoubleStackSide::eBottom);
+	}
+
+
+	[[nodiscard]]
+	auto LevelArena::allocateScratch(size_type size, size_type alignment) noexcept -> pointer {
+		return this->m_allocate(size, alignment, DoubleStackSide::eTop);
+	}
+
+
+	[[nodiscard]]
+	auto LevelArena::promote(const void *scratch, size_type size, size_type alignment) noexcept -> pointer {
+		pointer persistent {this->m_allocate(size, alignment, DoubleStackSide::eBottom)};
+		if (persistent == nullptr)
+			return nullptr;
+		// the persistent side is always below the scratch side, so the ranges can't overlap
+		std::memcpy(persistent, scratch, size);
+		return persistent;
+	}
+
+
+	auto LevelArena::m_allocate(size_type size, size_type alignment, DoubleStackSide side) noexcept -> pointer {
+		pointer ptr {m_allocator.allocate(size, alignment, side)};
+		if (ptr != nullptr)
+			return ptr;
+
+		++m_collisionCount;
+		m_lastCollision = LevelArenaCollision{side, size, m_allocator.getFreeSize()};
+		if (m_collisionCallback)
+			m_collisionCallback(m_lastCollision);
+		return nullptr;
+	}
+
+} // namespace sl::memory
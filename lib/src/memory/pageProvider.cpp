@@ -0,0 +1,134 @@
+#include "sl/memory/pageProvider.hpp"
+
+#include <cstdint>
+
+#include "sl/memory/virtualMemory.hpp"
+
+#ifdef SL_LINUX
+	#include <linux/mempolicy.h>
+	#include <sys/mman.h>
+	#include <sys/syscall.h>
+	#include <unistd.h>
+#elifdef SL_WINDOWS
+	#include <Windows.h>
+#endif
+
+
+namespace sl::memory {
+	static auto s_getHugePageSize() noexcept -> sl::utils::Bytes {
+	#ifdef SL_LINUX
+		return 2_MiB;
+	#elifdef SL_WINDOWS
+		static const sl::utils::Bytes hugePageSize {[]() -> std::size_t {
+			const std::size_t size {GetLargePageMinimum()};
+			return size == 0 ? 2 * 1024 * 1024 : size;
+		} ()};
+		return hugePageSize;
+	#endif
+	}
+
+
+	// Writes to every page, so that they get backed by physical memory following the placement policy of the range
+	static auto s_touchPages(std::byte *address, std::size_t size) noexcept -> void {
+		const std::size_t pageSize {sl::memory::getVirtualMemoryPageSize()};
+		for (std::size_t offset {0}; offset < size; offset += pageSize)
+			reinterpret_cast<volatile std::byte*> (address)[offset] = std::byte{0};
+	}
+
+
+	PageProvider::PageProvider(const PageProviderCreateInfos &createInfos) noexcept :
+		m_createInfos {createInfos}
+	{
+
+	}
+
+
+	[[nodiscard]]
+	auto PageProvider::allocate(sl::utils::Bytes requestedSize) const noexcept -> std::byte* {
+		const std::size_t granularity {this->getGranularity()};
+		const std::size_t size {(static_cast<std::size_t> (requestedSize) + granularity - 1) / granularity * granularity};
+		if (size == 0)
+			return nullptr;
+
+		const bool isPlaced {m_createInfos.numaNode != NO_NUMA_NODE};
+		std::byte *memory {nullptr};
+
+	#ifdef SL_LINUX
+		// placement must be set before the first touch, so MAP_POPULATE can only be used without a NUMA node
+		const int populateFlag {m_createInfos.prefault && !isPlaced ? MAP_POPULATE : 0};
+		bool needsTouch {m_createInfos.prefault && isPlaced};
+
+		if (m_createInfos.hugePages == HugePageMode::eExplicit) {
+			void *address {mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB | populateFlag, -1, 0)};
+			if (address != MAP_FAILED)
+				memory = reinterpret_cast<std::byte*> (address);
+		}
+
+		if (memory == nullptr && m_createInfos.hugePages != HugePageMode::eNone) {
+			// over-map so that the range can be trimmed to a huge page boundary, which transparent huge pages need
+			const std::size_t mappedSize {size + granularity};
+			void *address {mmap(nullptr, mappedSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0)};
+			if (address == MAP_FAILED)
+				return nullptr;
+
+			std::byte *mapped {reinterpret_cast<std::byte*> (address)};
+			memory = reinterpret_cast<std::byte*> ((reinterpret_cast<std::uintptr_t> (mapped) + granularity - 1) / granularity * granularity);
+			if (memory != mapped)
+				(void)munmap(mapped, static_cast<std::size_t> (memory - mapped));
+			if (memory + size != mapped + mappedSize)
+				(void)munmap(memory + size, static_cast<std::size_t> (mapped + mappedSize - (memory + size)));
+			(void)madvise(memory, size, MADV_HUGEPAGE);
+			needsTouch = m_createInfos.prefault;
+		}
+
+		if (memory == nullptr) {
+			void *address {mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | populateFlag, -1, 0)};
+			if (address == MAP_FAILED)
+				return nullptr;
+			memory = reinterpret_cast<std::byte*> (address);
+		}
+
+		if (isPlaced && m_createInfos.numaNode < sizeof(unsigned long) * 8) {
+			const unsigned long nodeMask {1ul << m_createInfos.numaNode};
+			(void)syscall(SYS_mbind, memory, size, MPOL_PREFERRED, &nodeMask, sizeof(nodeMask) * 8, 0);
+		}
+
+	#elifdef SL_WINDOWS
+		const DWORD allocationType {MEM_RESERVE | MEM_COMMIT};
+		const DWORD node {isPlaced ? static_cast<DWORD> (m_createInfos.numaNode) : NUMA_NO_PREFERRED_NODE};
+		// Windows has no transparent huge pages, so both modes ask for large pages, which need SeLockMemoryPrivilege
+		if (m_createInfos.hugePages != HugePageMode::eNone)
+			memory = reinterpret_cast<std::byte*> (VirtualAllocExNuma(GetCurrentProcess(), nullptr, size, allocationType | MEM_LARGE_PAGES, PAGE_READWRITE, node));
+		if (memory == nullptr)
+			memory = reinterpret_cast<std::byte*> (VirtualAllocExNuma(GetCurrentProcess(), nullptr, size, allocationType, PAGE_READWRITE, node));
+		if (memory == nullptr)
+			return nullptr;
+		const bool needsTouch {m_createInfos.prefault};
+	#endif
+
+		if (needsTouch)
+			s_touchPages(memory, size);
+		return memory;
+	}
+
+
+	auto PageProvider::deallocate(std::byte *address, sl::utils::Bytes size) const noexcept -> void {
+		if (address == nullptr)
+			return;
+	#ifdef SL_LINUX
+		const std::size_t granularity {this->getGranularity()};
+		(void)munmap(address, (static_cast<std::size_t> (size) + granularity - 1) / granularity * granularity);
+	#elifdef SL_WINDOWS
+		(void)size;
+		(void)VirtualFree(address, 0, MEM_RELEASE);
+	#endif
+	}
+
+
+	auto PageProvider::getGranularity() const noexcept -> sl::utils::Bytes {
+		if (m_createInfos.hugePages == HugePageMode::eNone)
+			return sl::memory::getVirtualMemoryPageSize();
+		return s_getHugePageSize();
+	}
+
+} // namespace sl::memory
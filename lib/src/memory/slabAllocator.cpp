@@ -0,0 +1,160 @@
+#include "sl/memory/slabAllocator.hpp"
+
+#include <algorithm>
+#include <new>
+
+#include "sl/utils/assert.hpp"
+
+
+namespace sl::memory {
+	SlabAllocator::SlabAllocator(const SlabAllocatorCreateInfos &createInfos) noexcept :
+		m_slabSize {createInfos.slabSize},
+		m_pageProvider {createInfos.pages},
+		m_upstream {createInfos.upstream},
+		m_sizeClasses {},
+		m_slabs {},
+		m_stats {"SlabAllocator"}
+	{
+		SL_TEXT_ASSERT(m_slabSize >= MAX_SIZE_CLASS, "SlabAllocator's slabs must hold at least a block of the largest size class");
+	}
+
+
+	SlabAllocator::~SlabAllocator() {
+		this->m_release();
+	}
+
+
+	SlabAllocator::SlabAllocator(SlabAllocator &&allocator) noexcept :
+		m_slabSize {allocator.m_slabSize},
+		m_pageProvider {allocator.m_pageProvider},
+		m_upstream {allocator.m_upstream},
+		m_sizeClasses {allocator.m_sizeClasses},
+		m_slabs {std::move(allocator.m_slabs)},
+		m_stats {std::move(allocator.m_stats)}
+	{
+		allocator.m_sizeClasses = {};
+		allocator.m_slabs.clear();
+	}
+
+
+	auto SlabAllocator::operator=(SlabAllocator &&allocator) noexcept -> SlabAllocator& {
+		if (this == &allocator)
+			return *this;
+		this->m_release();
+
+		m_slabSize = allocator.m_slabSize;
+		m_pageProvider = allocator.m_pageProvider;
+		m_upstream = allocator.m_upstream;
+		m_sizeClasses = allocator.m_sizeClasses;
+		m_slabs = std::move(allocator.m_slabs);
+		m_stats = std::move(allocator.m_stats);
+
+		allocator.m_sizeClasses = {};
+		allocator.m_slabs.clear();
+
+		return *this;
+	}
+
+
+	[[nodiscard]]
+	auto SlabAllocator::allocate(size_type size, size_type alignment) noexcept -> pointer {
+		const size_type index {s_getSizeClassIndex(size, alignment)};
+		if (index == NO_SIZE_CLASS) {
+			// memory resources report failures by throwing, which can't go through this noexcept function
+			try {
+				return reinterpret_cast<pointer> (m_upstream->allocate(size, alignment));
+			}
+			catch (const std::bad_alloc &) {
+				m_stats.onFailedAllocation();
+				return nullptr;
+			}
+		}
+
+		SizeClass &sizeClass {m_sizeClasses[index]};
+		if (sizeClass.freeList != nullptr) {
+			FreeBlock *block {sizeClass.freeList};
+			sizeClass.freeList = block->next;
+			m_stats.onAllocation(SIZE_CLASSES[index]);
+			return reinterpret_cast<pointer> (block);
+		}
+
+		if (static_cast<size_type> (sizeClass.slabEnd - sizeClass.slabTop) < SIZE_CLASSES[index] && !this->m_addSlab(sizeClass)) {
+			m_stats.onFailedAllocation();
+			return nullptr;
+		}
+
+		pointer block {sizeClass.slabTop};
+		sizeClass.slabTop += SIZE_CLASSES[index];
+		m_stats.onAllocation(SIZE_CLASSES[index]);
+		return block;
+	}
+
+
+	auto SlabAllocator::deallocate(pointer ptr, size_type size, size_type alignment) noexcept -> void {
+		if (ptr == nullptr)
+			return;
+
+		const size_type index {s_getSizeClassIndex(size, alignment)};
+		if (index == NO_SIZE_CLASS)
+			return m_upstream->deallocate(ptr, size, alignment);
+
+		SizeClass &sizeClass {m_sizeClasses[index]};
+		FreeBlock *block {reinterpret_cast<FreeBlock*> (ptr)};
+		block->next = sizeClass.freeList;
+		sizeClass.freeList = block;
+		m_stats.onDeallocation(SIZE_CLASSES[index]);
+	}
+
+
+	auto SlabAllocator::getBlockSize(size_type size, size_type alignment) noexcept -> size_type {
+		const size_type index {s_getSizeClassIndex(size, alignment)};
+		return index == NO_SIZE_CLASS ? 0 : SIZE_CLASSES[index];
+	}
+
+
+	auto SlabAllocator::s_getSizeClassIndex(size_type size, size_type alignment) noexcept -> size_type {
+		// maps every multiple of SIZE_CLASS_GRANULARITY to the smallest size class that can hold it
+		static constexpr auto SIZE_CLASS_LOOKUP {[] {
+			std::array<std::uint8_t, MAX_SIZE_CLASS / SIZE_CLASS_GRANULARITY + 1> lookup {};
+			size_type index {0};
+			for (size_type i {0}; i < lookup.size(); ++i) {
+				while (SIZE_CLASSES[index] < i * SIZE_CLASS_GRANULARITY)
+					++index;
+				lookup[i] = static_cast<std::uint8_t> (index);
+			}
+			return lookup;
+		} ()};
+
+		if (size > MAX_SIZE_CLASS)
+			return NO_SIZE_CLASS;
+
+		// blocks are aligned on the largest power of two their size is a multiple of, as slabs are page aligned
+		size_type index {SIZE_CLASS_LOOKUP[(size + SIZE_CLASS_GRANULARITY - 1) / SIZE_CLASS_GRANULARITY]};
+		while (index < NO_SIZE_CLASS && SIZE_CLASSES[index] % alignment != 0)
+			++index;
+		return index;
+	}
+
+
+	auto SlabAllocator::m_addSlab(SizeClass &sizeClass) noexcept -> bool {
+		pointer slab {m_pageProvider.allocate(m_slabSize)};
+		if (slab == nullptr)
+			return false;
+
+		m_slabs.push_back(slab);
+		sizeClass.slabTop = slab;
+		sizeClass.slabEnd = slab + m_slabSize;
+		m_stats.setCapacity(m_slabSize * m_slabs.size());
+		return true;
+	}
+
+
+	auto SlabAllocator::m_release() noexcept -> void {
+		for (pointer slab : m_slabs)
+			m_pageProvider.deallocate(slab, m_slabSize);
+		m_slabs.clear();
+		m_sizeClasses = {};
+		m_stats.setCapacity(0_B);
+	}
+
+} // namespace sl::memory
@@ -1,46 +1,98 @@
 #include "sl/memory/stackAllocator.hpp"
 
+#include <algorithm>
+
+#include "sl/memory/virtualMemory.hpp"
+
 
 namespace sl::memory {
 	StackAllocator::StackAllocator(sl::utils::Bytes size) noexcept :
 		m_stackSize {size},
-		m_stackBase {reinterpret_cast<pointer> (std::malloc(m_stackSize))},
-		m_stackTop {m_stackBase}
+		m_stackBase {nullptr},
+		m_stackTop {nullptr},
+		m_committedTop {nullptr},
+		m_isVirtual {false},
+		m_highWaterMark {m_stackSize},
+		m_pageProvider {},
+		m_stats {"StackAllocator", m_stackSize}
 	{
+		m_stackBase = m_pageProvider.allocate(m_stackSize);
+		if (m_stackBase == nullptr)
+			m_stackSize = 0_B;
+		m_stackTop = m_stackBase;
+		m_committedTop = m_stackBase + m_stackSize;
+	}
+
 
+	StackAllocator::StackAllocator(const StackAllocatorCreateInfos &createInfos) noexcept :
+		m_stackSize {createInfos.size},
+		m_stackBase {nullptr},
+		m_stackTop {nullptr},
+		m_committedTop {nullptr},
+		m_isVirtual {createInfos.isVirtual},
+		m_highWaterMark {createInfos.highWaterMark},
+		m_pageProvider {createInfos.pages},
+		m_stats {"StackAllocator", createInfos.size}
+	{
+		if (!m_isVirtual) {
+			m_stackBase = m_pageProvider.allocate(m_stackSize);
+			if (m_stackBase == nullptr)
+				m_stackSize = 0_B;
+			m_stackTop = m_stackBase;
+			m_committedTop = m_stackBase + m_stackSize;
+			return;
+		}
+
+		const size_type pageSize {sl::memory::getVirtualMemoryPageSize()};
+		m_stackSize = (m_stackSize + pageSize - 1) / pageSize * pageSize;
+		m_stackBase = sl::memory::reserveVirtualMemory(m_stackSize);
+		if (m_stackBase == nullptr)
+			m_stackSize = 0_B;
+		m_stackTop = m_stackBase;
+		m_committedTop = m_stackBase;
 	}
 
 
 	StackAllocator::~StackAllocator() {
-		if (m_stackBase != nullptr)
-			std::free(m_stackBase);
-		m_stackSize = 0_B;
-		m_stackTop = nullptr;
-		m_stackBase = nullptr;
+		this->m_release();
 	}
 
 
 	StackAllocator::StackAllocator(StackAllocator &&allocator) noexcept :
 		m_stackSize {allocator.m_stackSize},
 		m_stackBase {allocator.m_stackBase},
-		m_stackTop {allocator.m_stackTop}
+		m_stackTop {allocator.m_stackTop},
+		m_committedTop {allocator.m_committedTop},
+		m_isVirtual {allocator.m_isVirtual},
+		m_highWaterMark {allocator.m_highWaterMark},
+		m_pageProvider {allocator.m_pageProvider},
+		m_stats {std::move(allocator.m_stats)}
 	{
 		allocator.m_stackSize = 0_B;
 		allocator.m_stackBase = nullptr;
 		allocator.m_stackTop = nullptr;
+		allocator.m_committedTop = nullptr;
 	}
 
 
 	auto StackAllocator::operator=(StackAllocator &&allocator) noexcept -> StackAllocator& {
-		this->~StackAllocator();
+		if (this == &allocator)
+			return *this;
+		this->m_release();
 
 		m_stackSize = allocator.m_stackSize;
 		m_stackBase = allocator.m_stackBase;
 		m_stackTop = allocator.m_stackTop;
+		m_committedTop = allocator.m_committedTop;
+		m_isVirtual = allocator.m_isVirtual;
+		m_highWaterMark = allocator.m_highWaterMark;
+		m_pageProvider = allocator.m_pageProvider;
+		m_stats = std::move(allocator.m_stats);
 
 		allocator.m_stackSize = 0_B;
 		allocator.m_stackBase = nullptr;
 		allocator.m_stackTop = nullptr;
+		allocator.m_committedTop = nullptr;
 
 		return *this;
 	}
@@ -52,9 +104,14 @@ namespace sl::memory {
 		if (reinterpret_cast<size_type> (tmpStackTop) % alignment != 0)
 			tmpStackTop += alignment - (reinterpret_cast<size_type> (tmpStackTop) % alignment);
 
-		if ((m_stackBase + m_stackSize) - (tmpStackTop + size) < 0)
+		if ((m_stackBase + m_stackSize) - (tmpStackTop + size) < 0
+			|| (tmpStackTop + size > m_committedTop && !this->m_commitUpTo(tmpStackTop + size))
+		) {
+			m_stats.onFailedAllocation();
 			return nullptr;
+		}
 
+		m_stats.onAllocation(static_cast<size_type> (tmpStackTop + size - m_stackTop));
 		m_stackTop = tmpStackTop + size;
 		return tmpStackTop;
 	}
@@ -67,12 +124,53 @@ namespace sl::memory {
 
 
 	auto StackAllocator::deallocate(Marker marker) noexcept -> void {
+		if (marker.m_marker < m_stackTop)
+			m_stats.onDeallocation(static_cast<size_type> (m_stackTop - marker.m_marker));
 		m_stackTop = marker.m_marker;
 	}
 
 
 	auto StackAllocator::clear() noexcept -> void {
+		m_stats.onDeallocation(this->getUsedSize());
 		m_stackTop = m_stackBase;
+		if (!m_isVirtual || this->getCommittedSize() <= m_highWaterMark)
+			return;
+
+		const size_type pageSize {sl::memory::getVirtualMemoryPageSize()};
+		pointer keptCommittedTop {m_stackBase + (m_highWaterMark + pageSize - 1) / pageSize * pageSize};
+		if (keptCommittedTop >= m_committedTop)
+			return;
+		sl::memory::decommitVirtualMemory(keptCommittedTop, static_cast<size_type> (m_committedTop - keptCommittedTop));
+		m_committedTop = keptCommittedTop;
+	}
+
+
+	auto StackAllocator::m_commitUpTo(pointer top) noexcept -> bool {
+		if (!m_isVirtual)
+			return false;
+
+		const size_type granularity {std::max<size_type> (MIN_COMMIT_SIZE, sl::memory::getVirtualMemoryPageSize())};
+		size_type committedSize {static_cast<size_type> (top - m_stackBase)};
+		committedSize = std::min<size_type> ((committedSize + granularity - 1) / granularity * granularity, m_stackSize);
+		if (!sl::memory::commitVirtualMemory(m_committedTop, committedSize - this->getCommittedSize()))
+			return false;
+
+		m_committedTop = m_stackBase + committedSize;
+		return true;
+	}
+
+
+	auto StackAllocator::m_release() noexcept -> void {
+		if (m_stackBase != nullptr) {
+			if (m_isVirtual)
+				sl::memory::releaseVirtualMemory(m_stackBase, m_stackSize);
+			else
+				m_pageProvider.deallocate(m_stackBase, m_stackSize);
+		}
+		m_stackSize = 0_B;
+		m_stackTop = nullptr;
+		m_stackBase = nullptr;
+		m_committedTop = nullptr;
 	}
 
 } // namespace sl::memory
@@ -0,0 +1,207 @@
+#include "sl/memory/trackingAllocator.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdlib>
+
+#ifdef SL_LINUX
+	#include <execinfo.h>
+#elifdef SL_WINDOWS
+	#include <Windows.h>
+#endif
+
+
+namespace sl::memory {
+	MemoryTracker::MemoryTracker(const MemoryTrackerCreateInfos &createInfos) noexcept :
+		m_mutex {},
+		m_callstackSamplingPeriod {createInfos.callstackSamplingPeriod},
+		m_reportOnDestruction {createInfos.reportOnDestruction},
+		m_frameIndex {0},
+		m_allocationCount {0},
+		m_liveAllocations {},
+		m_freedAddresses {},
+		m_freedAddressCursor {0},
+		m_invalidDeallocations {},
+		m_tagUsages {}
+	{
+
+	}
+
+
+	MemoryTracker::~MemoryTracker() {
+		if (!m_reportOnDestruction || (m_liveAllocations.empty() && m_invalidDeallocations.empty()))
+			return;
+		this->report(std::cerr);
+	}
+
+
+	auto MemoryTracker::onAllocation(const void *address, sl::utils::Bytes size, std::size_t alignment, std::string_view tag) noexcept -> void {
+		std::lock_guard<std::mutex> _ {m_mutex};
+		const bool isSampled {m_callstackSamplingPeriod != 0 && m_allocationCount % m_callstackSamplingPeriod == 0};
+		++m_allocationCount;
+
+		m_liveAllocations.insert_or_assign(address, TrackedAllocation{
+			address,
+			size,
+			alignment,
+			m_frameIndex,
+			tag,
+			isSampled ? s_captureCallstack() : std::vector<void*> {}
+		});
+
+		TagUsage &usage {m_tagUsages.try_emplace(tag, TagUsage{tag, 0_B, 0, 0_B, 0}).first->second};
+		usage.liveSize += size;
+		++usage.liveCount;
+		++usage.allocationCount;
+		if (usage.liveSize > usage.peakSize)
+			usage.peakSize = usage.liveSize;
+	}
+
+
+	auto MemoryTracker::onDeallocation(const void *address, std::string_view tag) noexcept -> bool {
+		std::lock_guard<std::mutex> _ {m_mutex};
+		auto allocation {m_liveAllocations.find(address)};
+		if (allocation == m_liveAllocations.end()) {
+			m_invalidDeallocations.emplace_back(address, m_frameIndex, tag, std::ranges::find(m_freedAddresses, address) != m_freedAddresses.end());
+			return false;
+		}
+
+		TagUsage &usage {m_tagUsages[allocation->second.tag]};
+		usage.liveSize -= allocation->second.size;
+		--usage.liveCount;
+
+		m_liveAllocations.erase(allocation);
+		this->m_recordFreedAddress(address);
+		return true;
+	}
+
+
+	auto MemoryTracker::onBulkDeallocation(std::string_view tag) noexcept -> void {
+		std::lock_guard<std::mutex> _ {m_mutex};
+		(void)std::erase_if(m_liveAllocations, [this, tag](const auto &allocation) -> bool {
+			if (allocation.second.tag != tag)
+				return false;
+			this->m_recordFreedAddress(allocation.first);
+			return true;
+		});
+
+		if (auto usage {m_tagUsages.find(tag)}; usage != m_tagUsages.end()) {
+			usage->second.liveSize = 0_B;
+			usage->second.liveCount = 0;
+		}
+	}
+
+
+	auto MemoryTracker::endFrame() noexcept -> void {
+		std::lock_guard<std::mutex> _ {m_mutex};
+		++m_frameIndex;
+	}
+
+
+	auto MemoryTracker::getFrameIndex() const noexcept -> std::size_t {
+		std::lock_guard<std::mutex> _ {m_mutex};
+		return m_frameIndex;
+	}
+
+
+	auto MemoryTracker::getLiveAllocations() const noexcept -> std::vector<TrackedAllocation> {
+		std::vector<TrackedAllocation> allocations {};
+		{
+			std::lock_guard<std::mutex> _ {m_mutex};
+			allocations.reserve(m_liveAllocations.size());
+			for (const auto &allocation : m_liveAllocations)
+				allocations.push_back(allocation.second);
+		}
+
+		std::ranges::sort(allocations, std::less<const void*> {}, &TrackedAllocation::address);
+		return allocations;
+	}
+
+
+	auto MemoryTracker::getInvalidDeallocations() const noexcept -> std::vector<InvalidDeallocation> {
+		std::lock_guard<std::mutex> _ {m_mutex};
+		return m_invalidDeallocations;
+	}
+
+
+	auto MemoryTracker::getTagUsages() const noexcept -> std::vector<TagUsage> {
+		std::vector<TagUsage> usages {};
+		{
+			std::lock_guard<std::mutex> _ {m_mutex};
+			usages.reserve(m_tagUsages.size());
+			for (const auto &usage : m_tagUsages)
+				usages.push_back(usage.second);
+		}
+
+		std::ranges::sort(usages, std::greater<sl::utils::Bytes> {}, &TagUsage::liveSize);
+		return usages;
+	}
+
+
+	auto MemoryTracker::report(std::ostream &stream) const noexcept -> void {
+		const std::vector<TrackedAllocation> allocations {this->getLiveAllocations()};
+		const std::vector<InvalidDeallocation> invalidDeallocations {this->getInvalidDeallocations()};
+
+		stream << allocations.size() << " live allocations\n";
+		for (const auto &allocation : allocations) {
+			stream << "\t" << allocation.address << " : " << static_cast<std::size_t> (allocation.size) << " B aligned on "
+				<< allocation.alignment << ", tag '" << allocation.tag << "', frame " << allocation.frameIndex << "\n";
+			s_printCallstack(stream, allocation.callstack);
+		}
+
+		stream << invalidDeallocations.size() << " invalid deallocations\n";
+		for (const auto &deallocation : invalidDeallocations) {
+			stream << "\t" << deallocation.address << " : " << (deallocation.isDoubleFree ? "double free" : "unknown address")
+				<< ", tag '" << deallocation.tag << "', frame " << deallocation.frameIndex << "\n";
+		}
+
+		stream << "Usage by tag\n";
+		for (const auto &usage : this->getTagUsages()) {
+			stream << "\t" << usage.tag << " : " << static_cast<std::size_t> (usage.liveSize) << " B in " << usage.liveCount
+				<< " allocations (peak " << static_cast<std::size_t> (usage.peakSize) << " B, " << usage.allocationCount << " allocations in total)\n";
+		}
+	}
+
+
+	auto MemoryTracker::m_recordFreedAddress(const void *address) noexcept -> void {
+		if (m_freedAddresses.size() < FREED_ADDRESS_HISTORY_SIZE) {
+			m_freedAddresses.push_back(address);
+			return;
+		}
+
+		m_freedAddresses[m_freedAddressCursor] = address;
+		m_freedAddressCursor = (m_freedAddressCursor + 1) % FREED_ADDRESS_HISTORY_SIZE;
+	}
+
+
+	auto MemoryTracker::s_captureCallstack() noexcept -> std::vector<void*> {
+		std::array<void*, MAX_CALLSTACK_DEPTH> frames {};
+		std::size_t depth {0};
+	#ifdef SL_LINUX
+		depth = static_cast<std::size_t> (backtrace(frames.data(), static_cast<int> (frames.size())));
+	#elifdef SL_WINDOWS
+		depth = static_cast<std::size_t> (CaptureStackBackTrace(0, static_cast<DWORD> (frames.size()), frames.data(), nullptr));
+	#endif
+		return std::vector<void*> (frames.begin(), frames.begin() + depth);
+	}
+
+
+	auto MemoryTracker::s_printCallstack(std::ostream &stream, const std::vector<void*> &callstack) noexcept -> void {
+		if (callstack.empty())
+			return;
+
+	#ifdef SL_LINUX
+		char **symbols {backtrace_symbols(callstack.data(), static_cast<int> (callstack.size()))};
+		if (symbols != nullptr) {
+			for (std::size_t i {0}; i < callstack.size(); ++i)
+				stream << "\t\t" << symbols[i] << "\n";
+			std::free(symbols);
+			return;
+		}
+	#endif
+
+		for (const void *frame : callstack)
+			stream << "\t\t" << frame << "\n";
+	}
+
+} // namespace sl::memory
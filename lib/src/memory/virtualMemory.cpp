@@ -0,0 +1,70 @@
+#include "sl/memory/virtualMemory.hpp"
+
+#ifdef SL_LINUX
+	#include <sys/mman.h>
+	#include <unistd.h>
+#elifdef SL_WINDOWS
+	#include <Windows.h>
+#endif
+
+
+namespace sl::memory {
+	auto getVirtualMemoryPageSize() noexcept -> sl::utils::Bytes {
+	#ifdef SL_LINUX
+		static const sl::utils::Bytes pageSize {static_cast<std::size_t> (sysconf(_SC_PAGESIZE))};
+	#elifdef SL_WINDOWS
+		static const sl::utils::Bytes pageSize {[]() -> std::size_t {
+			SYSTEM_INFO systemInfo {};
+			GetSystemInfo(&systemInfo);
+			return static_cast<std::size_t> (systemInfo.dwPageSize);
+		} ()};
+	#endif
+		return pageSize;
+	}
+
+
+	[[nodiscard]]
+	auto reserveVirtualMemory(sl::utils::Bytes size) noexcept -> std::byte* {
+	#ifdef SL_LINUX
+		void *address {mmap(nullptr, size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0)};
+		if (address == MAP_FAILED)
+			return nullptr;
+		return reinterpret_cast<std::byte*> (address);
+	#elifdef SL_WINDOWS
+		return reinterpret_cast<std::byte*> (VirtualAlloc(nullptr, size, MEM_RESERVE, PAGE_NOACCESS));
+	#endif
+	}
+
+
+	auto releaseVirtualMemory(std::byte *address, sl::utils::Bytes size) noexcept -> void {
+		if (address == nullptr)
+			return;
+	#ifdef SL_LINUX
+		(void)munmap(address, size);
+	#elifdef SL_WINDOWS
+		(void)size;
+		(void)VirtualFree(address, 0, MEM_RELEASE);
+	#endif
+	}
+
+
+	[[nodiscard]]
+	auto commitVirtualMemory(std::byte *address, sl::utils::Bytes size) noexcept -> bool {
+	#ifdef SL_LINUX
+		return mprotect(address, size, PROT_READ | PROT_WRITE) == 0;
+	#elifdef SL_WINDOWS
+		return VirtualAlloc(address, size, MEM_COMMIT, PAGE_READWRITE) != nullptr;
+	#endif
+	}
+
+
+	auto decommitVirtualMemory(std::byte *address, sl::utils::Bytes size) noexcept -> void {
+	#ifdef SL_LINUX
+		(void)madvise(address, size, MADV_DONTNEED);
+		(void)mprotect(address, size, PROT_NONE);
+	#elifdef SL_WINDOWS
+		(void)VirtualFree(address, size, MEM_DECOMMIT);
+	#endif
+	}
+
+} // namespace sl::memory
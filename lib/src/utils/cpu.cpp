@@ -0,0 +1,41 @@
+#include "sl/utils/cpu.hpp"
+
+#if (defined(__x86_64__) || defined(_M_X64)) && defined(_MSC_VER)
+	#include <intrin.h>
+#endif
+
+
+namespace sl::utils {
+	static auto detectAVX2() noexcept -> bool {
+	#if defined(__x86_64__) || defined(_M_X64)
+		#ifdef _MSC_VER
+			int registers[4] {};
+			__cpuidex(registers, 0, 0);
+			if (registers[0] < 7)
+				return false;
+
+			// the OS must save the ymm registers too
+			constexpr int OSXSAVE_AND_AVX_BITS {(1 << 27) | (1 << 28)};
+			__cpuidex(registers, 1, 0);
+			if ((registers[2] & OSXSAVE_AND_AVX_BITS) != OSXSAVE_AND_AVX_BITS || (_xgetbv(0) & 0b110) != 0b110)
+				return false;
+
+			constexpr int AVX2_BIT {1 << 5};
+			__cpuidex(registers, 7, 0);
+			return (registers[1] & AVX2_BIT) != 0;
+		#else
+			__builtin_cpu_init();
+			return __builtin_cpu_supports("avx2");
+		#endif
+	#else
+		return false;
+	#endif
+	}
+
+
+	auto hasAVX2() noexcept -> bool {
+		static const bool result {detectAVX2()};
+		return result;
+	}
+
+} // namespace sl::utils
@@ -0,0 +1,59 @@
+#include "sl/utils/hash.hpp"
+
+#include "sl/utils/cpu.hpp"
+
+#if defined(__x86_64__) || defined(_M_X64)
+	#include <emmintrin.h>
+
+	#include "hashKernels.inl"
+#endif
+
+
+namespace sl::utils::simd {
+#if defined(__x86_64__) || defined(_M_X64)
+	// defined in hashAVX2.cpp, which is compiled with AVX2 enabled
+	namespace avx2 {
+		auto hashAccumulate(const char *data, std::size_t size, std::uint64_t (&accumulators)[8]) noexcept -> void;
+	} // namespace avx2
+
+
+	struct HashSSE2 {
+		using Vector = __m128i;
+		static constexpr std::size_t LANES {2};
+
+		static inline auto load(const void *data) noexcept -> Vector {return _mm_loadu_si128(reinterpret_cast<const __m128i*> (data));}
+		static inline auto store(std::uint64_t *data, Vector value) noexcept -> void {_mm_storeu_si128(reinterpret_cast<__m128i*> (data), value);}
+
+		static inline auto accumulate(Vector &accumulator, Vector value, Vector key) noexcept -> void {
+			const Vector keyed {_mm_xor_si128(value, key)};
+			const Vector product {_mm_mul_epu32(keyed, _mm_srli_epi64(keyed, 32))};
+			const Vector swapped {_mm_shuffle_epi32(value, _MM_SHUFFLE(1, 0, 3, 2))};
+			accumulator = _mm_add_epi64(accumulator, _mm_add_epi64(product, swapped));
+		}
+
+		static inline auto scramble(Vector &accumulator, Vector key) noexcept -> void {
+			const Vector prime {_mm_set1_epi32(static_cast<int> (HASH_SCRAMBLE_PRIME))};
+			accumulator = _mm_xor_si128(_mm_xor_si128(accumulator, _mm_srli_epi64(accumulator, 47)), key);
+			const Vector low {_mm_mul_epu32(accumulator, prime)};
+			const Vector high {_mm_mul_epu32(_mm_srli_epi64(accumulator, 32), prime)};
+			accumulator = _mm_add_epi64(low, _mm_slli_epi64(high, 32));
+		}
+	};
+
+
+	static const bool s_hasAVX2 {sl::utils::hasAVX2()};
+
+
+	auto hashAccumulate(const char *data, std::size_t size, std::uint64_t (&accumulators)[8]) noexcept -> void {
+		if (s_hasAVX2)
+			return avx2::hashAccumulate(data, size, accumulators);
+		hashAccumulateKernel<HashSSE2> (data, size, accumulators);
+	}
+
+#else
+	auto hashAccumulate(const char *data, std::size_t size, std::uint64_t (&accumulators)[8]) noexcept -> void {
+		sl::utils::__hash_accumulate(data, size, accumulators);
+	}
+#endif
+
+} // namespace sl::utils::simd
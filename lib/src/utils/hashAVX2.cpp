@@ -0,0 +1,40 @@
+#if defined(__x86_64__) || defined(_M_X64)
+
+#include <immintrin.h>
+
+#include "hashKernels.inl"
+
+
+// This file is compiled with AVX2 enabled, its functions must only be called after checking the CPU supports it
+namespace sl::utils::simd::avx2 {
+	struct HashAVX2 {
+		using Vector = __m256i;
+		static constexpr std::size_t LANES {4};
+
+		static inline auto load(const void *data) noexcept -> Vector {return _mm256_loadu_si256(reinterpret_cast<const __m256i*> (data));}
+		static inline auto store(std::uint64_t *data, Vector value) noexcept -> void {_mm256_storeu_si256(reinterpret_cast<__m256i*> (data), value);}
+
+		static inline auto accumulate(Vector &accumulator, Vector value, Vector key) noexcept -> void {
+			const Vector keyed {_mm256_xor_si256(value, key)};
+			const Vector product {_mm256_mul_epu32(keyed, _mm256_srli_epi64(keyed, 32))};
+			const Vector swapped {_mm256_shuffle_epi32(value, _MM_SHUFFLE(1, 0, 3, 2))};
+			accumulator = _mm256_add_epi64(accumulator, _mm256_add_epi64(product, swapped));
+		}
+
+		static inline auto scramble(Vector &accumulator, Vector key) noexcept -> void {
+			const Vector prime {_mm256_set1_epi32(static_cast<int> (HASH_SCRAMBLE_PRIME))};
+			accumulator = _mm256_xor_si256(_mm256_xor_si256(accumulator, _mm256_srli_epi64(accumulator, 47)), key);
+			const Vector low {_mm256_mul_epu32(accumulator, prime)};
+			const Vector high {_mm256_mul_epu32(_mm256_srli_epi64(accumulator, 32), prime)};
+			accumulator = _mm256_add_epi64(low, _mm256_slli_epi64(high, 32));
+		}
+	};
+
+
+	auto hashAccumulate(const char *data, std::size_t size, std::uint64_t (&accumulators)[8]) noexcept -> void {
+		hashAccumulateKernel<HashAVX2> (data, size, accumulators);
+	}
+
+} // namespace sl::utils::simd::avx2
+
+#endif
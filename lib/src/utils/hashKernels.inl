@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "sl/utils/hash.hpp"
+
+
+/*
+ * Long input hash kernel shared by the SSE2 and the AVX2 translation units, which instantiate it with an ISA struct
+ * providing :
+ *  - `Vector` and `LANES`, the count of 64-bit lanes of a vector
+ *  - `load(const void*) -> Vector`, unaligned
+ *  - `accumulate(Vector &accumulator, Vector value, Vector key)`, one stripe step of __hash_accumulateStripe
+ *  - `scramble(Vector &accumulator, Vector key)`, one lane group of __hash_scramble
+ *  - `store(std::uint64_t*, Vector)`, unaligned
+ * The kernel must give the exact same result as __hash_accumulate
+ */
+namespace sl::utils::simd {
+	template <typename ISA>
+	static auto hashAccumulateKernel(const char *data, std::size_t size, std::uint64_t (&accumulators)[8]) noexcept -> void {
+		static constexpr std::size_t VECTOR_COUNT {8 / ISA::LANES};
+		typename ISA::Vector vectors[VECTOR_COUNT] {};
+		typename ISA::Vector scrambleKeys[VECTOR_COUNT] {};
+		for (std::size_t i {0}; i < VECTOR_COUNT; ++i) {
+			vectors[i] = ISA::load(accumulators + i * ISA::LANES);
+			scrambleKeys[i] = ISA::load(HASH_LONG_KEY + HASH_STRIPES_PER_BLOCK + i * ISA::LANES);
+		}
+
+		const auto accumulateStripe = [&](const char *stripe, std::size_t keyOffset) noexcept {
+			for (std::size_t i {0}; i < VECTOR_COUNT; ++i)
+				ISA::accumulate(vectors[i], ISA::load(stripe + i * ISA::LANES * 8), ISA::load(HASH_LONG_KEY + keyOffset + i * ISA::LANES));
+		};
+
+		const std::size_t stripeCount {(size - 1) / HASH_STRIPE_SIZE};
+		for (std::size_t stripe {0}; stripe < stripeCount; ++stripe) {
+			accumulateStripe(data + stripe * HASH_STRIPE_SIZE, stripe % HASH_STRIPES_PER_BLOCK);
+			if ((stripe + 1) % HASH_STRIPES_PER_BLOCK == 0) {
+				for (std::size_t i {0}; i < VECTOR_COUNT; ++i)
+					ISA::scramble(vectors[i], scrambleKeys[i]);
+			}
+		}
+		accumulateStripe(data + size - HASH_STRIPE_SIZE, stripeCount % HASH_STRIPES_PER_BLOCK);
+
+		for (std::size_t i {0}; i < VECTOR_COUNT; ++i)
+			ISA::store(accumulators + i * ISA::LANES, vectors[i]);
+	}
+
+} // namespace sl::utils::simd
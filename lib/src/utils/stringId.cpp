@@ -0,0 +1,124 @@
+#include "sl/utils/stringId.hpp"
+
+#include <cstring>
+#include <new>
+
+#include "sl/utils/assert.hpp"
+
+
+namespace sl::utils {
+	static constexpr std::size_t INITIAL_CAPACITY {1024};
+	static constexpr sl::utils::Bytes ARENA_SIZE {64_MiB};
+
+
+	StringIdTable::Storage::Storage() noexcept :
+		arena {sl::memory::StackAllocatorCreateInfos{.size = ARENA_SIZE, .isVirtual = true}},
+		mutex {},
+		table {nullptr},
+		size {0}
+	{
+		table.store(s_createTable(*this, INITIAL_CAPACITY), std::memory_order_release);
+	}
+
+
+	[[maybe_unused]]
+	static auto isSameString(const char *data, std::size_t dataSize, const char *str, std::size_t size) noexcept -> bool {
+		return dataSize == size && std::memcmp(data, str, size) == 0;
+	}
+
+
+	auto StringIdTable::intern(const char *str, std::size_t size) noexcept -> StringId {
+		const StringId id {str, size};
+		Storage &storage {s_getStorage()};
+
+		const Entry *entry {s_probe(*storage.table.load(std::memory_order_acquire), id).load(std::memory_order_acquire)};
+		if (entry != nullptr) {
+			SL_TEXT_ASSERT(isSameString(entry->data, entry->size, str, size), "Two strings have the same StringId");
+			return id;
+		}
+
+		std::lock_guard<std::mutex> _ {storage.mutex};
+		// the growth is done by writers only, so the table can't change while we hold the lock
+		const Table *table {storage.table.load(std::memory_order_relaxed)};
+		std::atomic<const Entry*> *slot {&s_probe(*table, id)};
+		if (const Entry *existingEntry {slot->load(std::memory_order_relaxed)}; existingEntry != nullptr) {
+			SL_TEXT_ASSERT(isSameString(existingEntry->data, existingEntry->size, str, size), "Two strings have the same StringId");
+			return id;
+		}
+
+		// keeps the load factor under 1/2, so that the probe sequences stay short
+		if ((storage.size + 1) * 2 > table->capacity) {
+			Table *newTable {s_createTable(storage, table->capacity * 2)};
+			if (newTable == nullptr)
+				return id;
+			for (std::size_t i {0}; i < table->capacity; ++i) {
+				const Entry *oldEntry {table->slots[i].load(std::memory_order_relaxed)};
+				if (oldEntry != nullptr)
+					s_probe(*newTable, oldEntry->id).store(oldEntry, std::memory_order_relaxed);
+			}
+			storage.table.store(newTable, std::memory_order_release);
+			table = newTable;
+			slot = &s_probe(*table, id);
+		}
+
+		Entry *newEntry {reinterpret_cast<Entry*> (storage.arena.allocate(sizeof(Entry), alignof(Entry)))};
+		char *data {reinterpret_cast<char*> (storage.arena.allocate(size + 1, alignof(char)))};
+		SL_TEXT_ASSERT(newEntry != nullptr && data != nullptr, "StringIdTable arena is full");
+		if (newEntry == nullptr || data == nullptr)
+			return id;
+
+		std::memcpy(data, str, size);
+		data[size] = '\0';
+		newEntry = new (newEntry) Entry{id, static_cast<std::uint32_t> (size), data};
+		slot->store(newEntry, std::memory_order_release);
+		++storage.size;
+		return id;
+	}
+
+
+	auto StringIdTable::find(StringId id) noexcept -> const char* {
+		const Table *table {s_getStorage().table.load(std::memory_order_acquire)};
+		const Entry *entry {s_probe(*table, id).load(std::memory_order_acquire)};
+		return entry == nullptr ? nullptr : entry->data;
+	}
+
+
+	auto StringIdTable::getSize() noexcept -> std::size_t {
+		Storage &storage {s_getStorage()};
+		std::lock_guard<std::mutex> _ {storage.mutex};
+		return storage.size;
+	}
+
+
+	auto StringIdTable::s_getStorage() noexcept -> Storage& {
+		static Storage storage {};
+		return storage;
+	}
+
+
+	auto StringIdTable::s_probe(const Table &table, StringId id) noexcept -> std::atomic<const Entry*>& {
+		const std::size_t mask {table.capacity - 1};
+		for (std::size_t index {id.getValue() & mask};; index = (index + 1) & mask) {
+			const Entry *entry {table.slots[index].load(std::memory_order_acquire)};
+			if (entry == nullptr || entry->id == id)
+				return table.slots[index];
+		}
+	}
+
+
+	auto StringIdTable::s_createTable(Storage &storage, std::size_t capacity) noexcept -> Table* {
+		// the old tables are never freed, readers may still be probing them
+		Table *table {reinterpret_cast<Table*> (storage.arena.allocate(sizeof(Table), alignof(Table)))};
+		auto *slots {reinterpret_cast<std::atomic<const Entry*>*> (
+			storage.arena.allocate(sizeof(std::atomic<const Entry*>) * capacity, alignof(std::atomic<const Entry*>))
+		)};
+		SL_TEXT_ASSERT(table != nullptr && slots != nullptr, "StringIdTable arena is full");
+		if (table == nullptr || slots == nullptr)
+			return nullptr;
+
+		for (std::size_t i {0}; i < capacity; ++i)
+			new (slots + i) std::atomic<const Entry*> (nullptr);
+		return new (table) Table{capacity, slots};
+	}
+
+} // namespace sl::utils
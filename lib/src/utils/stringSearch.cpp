@@ -0,0 +1,119 @@
+#include "sl/utils/stringSearch.hpp"
+
+#include <cstring>
+
+#include "sl/utils/cpu.hpp"
+
+#if defined(__x86_64__) || defined(_M_X64)
+	#include <emmintrin.h>
+
+	#include "stringSearchKernels.inl"
+#endif
+
+
+namespace sl::utils::simd {
+#if defined(__x86_64__) || defined(_M_X64)
+	// defined in stringSearchAVX2.cpp, which is the only file compiled with AVX2 enabled
+	namespace avx2 {
+		auto findChar(const char *data, std::size_t size, char value) noexcept -> const char*;
+		auto findLastChar(const char *data, std::size_t size, char value) noexcept -> const char*;
+		auto find(const char *data, std::size_t size, const char *pattern, std::size_t patternSize) noexcept -> const char*;
+		auto findLast(const char *data, std::size_t size, const char *pattern, std::size_t patternSize) noexcept -> const char*;
+		auto compare(const char *lhs, const char *rhs, std::size_t size) noexcept -> int;
+	} // namespace avx2
+
+
+	struct SSE2 {
+		using Vector = __m128i;
+		static constexpr std::size_t WIDTH {16};
+		static constexpr std::uint32_t FULL_MASK {0xffff};
+
+		static inline auto broadcast(char value) noexcept -> Vector {return _mm_set1_epi8(value);}
+		static inline auto load(const char *data) noexcept -> Vector {return _mm_loadu_si128(reinterpret_cast<const __m128i*> (data));}
+		static inline auto equalMask(Vector lhs, Vector rhs) noexcept -> std::uint32_t {
+			return static_cast<std::uint32_t> (_mm_movemask_epi8(_mm_cmpeq_epi8(lhs, rhs)));
+		}
+	};
+
+
+	static const bool s_hasAVX2 {sl::utils::hasAVX2()};
+
+
+	auto findChar(const char *data, std::size_t size, char value) noexcept -> const char* {
+		if (s_hasAVX2)
+			return avx2::findChar(data, size, value);
+		return findCharKernel<SSE2> (data, size, value);
+	}
+
+
+	auto findLastChar(const char *data, std::size_t size, char value) noexcept -> const char* {
+		if (s_hasAVX2)
+			return avx2::findLastChar(data, size, value);
+		return findLastCharKernel<SSE2> (data, size, value);
+	}
+
+
+	auto find(const char *data, std::size_t size, const char *pattern, std::size_t patternSize) noexcept -> const char* {
+		if (s_hasAVX2)
+			return avx2::find(data, size, pattern, patternSize);
+		return findKernel<SSE2> (data, size, pattern, patternSize);
+	}
+
+
+	auto findLast(const char *data, std::size_t size, const char *pattern, std::size_t patternSize) noexcept -> const char* {
+		if (s_hasAVX2)
+			return avx2::findLast(data, size, pattern, patternSize);
+		return findLastKernel<SSE2> (data, size, pattern, patternSize);
+	}
+
+
+	auto compare(const char *lhs, const char *rhs, std::size_t size) noexcept -> int {
+		if (s_hasAVX2)
+			return avx2::compare(lhs, rhs, size);
+		return compareKernel<SSE2> (lhs, rhs, size);
+	}
+
+#else
+	auto findChar(const char *data, std::size_t size, char value) noexcept -> const char* {
+		return static_cast<const char*> (std::memchr(data, value, size));
+	}
+
+
+	auto findLastChar(const char *data, std::size_t size, char value) noexcept -> const char* {
+		for (std::size_t i {size}; i-- != 0;) {
+			if (data[i] == value)
+				return data + i;
+		}
+		return nullptr;
+	}
+
+
+	auto find(const char *data, std::size_t size, const char *pattern, std::size_t patternSize) noexcept -> const char* {
+		if (patternSize > size)
+			return nullptr;
+		for (std::size_t i {0}; i <= size - patternSize; ++i) {
+			if (std::memcmp(data + i, pattern, patternSize) == 0)
+				return data + i;
+		}
+		return nullptr;
+	}
+
+
+	auto findLast(const char *data, std::size_t size, const char *pattern, std::size_t patternSize) noexcept -> const char* {
+		if (patternSize > size)
+			return nullptr;
+		for (std::size_t i {size - patternSize + 1}; i-- != 0;) {
+			if (std::memcmp(data + i, pattern, patternSize) == 0)
+				return data + i;
+		}
+		return nullptr;
+	}
+
+
+	auto compare(const char *lhs, const char *rhs, std::size_t size) noexcept -> int {
+		const int result {std::memcmp(lhs, rhs, size)};
+		return result < 0 ? -1 : (result > 0 ? 1 : 0);
+	}
+#endif
+
+} // namespace sl::utils::simd
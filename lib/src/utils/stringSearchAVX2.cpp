@@ -0,0 +1,49 @@
+#if defined(__x86_64__) || defined(_M_X64)
+
+#include <immintrin.h>
+
+#include "stringSearchKernels.inl"
+
+
+// This file is compiled with AVX2 enabled, its functions must only be called after checking the CPU supports it
+namespace sl::utils::simd::avx2 {
+	struct AVX2 {
+		using Vector = __m256i;
+		static constexpr std::size_t WIDTH {32};
+		static constexpr std::uint32_t FULL_MASK {0xffffffff};
+
+		static inline auto broadcast(char value) noexcept -> Vector {return _mm256_set1_epi8(value);}
+		static inline auto load(const char *data) noexcept -> Vector {return _mm256_loadu_si256(reinterpret_cast<const __m256i*> (data));}
+		static inline auto equalMask(Vector lhs, Vector rhs) noexcept -> std::uint32_t {
+			return static_cast<std::uint32_t> (_mm256_movemask_epi8(_mm256_cmpeq_epi8(lhs, rhs)));
+		}
+	};
+
+
+	auto findChar(const char *data, std::size_t size, char value) noexcept -> const char* {
+		return findCharKernel<AVX2> (data, size, value);
+	}
+
+
+	auto findLastChar(const char *data, std::size_t size, char value) noexcept -> const char* {
+		return findLastCharKernel<AVX2> (data, size, value);
+	}
+
+
+	auto find(const char *data, std::size_t size, const char *pattern, std::size_t patternSize) noexcept -> const char* {
+		return findKernel<AVX2> (data, size, pattern, patternSize);
+	}
+
+
+	auto findLast(const char *data, std::size_t size, const char *pattern, std::size_t patternSize) noexcept -> const char* {
+		return findLastKernel<AVX2> (data, size, pattern, patternSize);
+	}
+
+
+	auto compare(const char *lhs, const char *rhs, std::size_t size) noexcept -> int {
+		return compareKernel<AVX2> (lhs, rhs, size);
+	}
+
+} // namespace sl::utils::simd::avx2
+
+#endif
@@ -0,0 +1,141 @@
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+
+/*
+ * Search kernels shared by the SSE2 and the AVX2 translation units, which instantiate them with an ISA struct providing :
+ *  - `Vector`, `WIDTH` and `FULL_MASK`, the mask with one bit per byte of a vector
+ *  - `broadcast(char) -> Vector`
+ *  - `load(const char*) -> Vector`, unaligned
+ *  - `equalMask(Vector, Vector) -> std::uint32_t`, with the bit i set when the byte i of both vectors is equal
+ * The kernels are static, so that the AVX2 instantiations can never be merged with the SSE2 ones
+ */
+namespace sl::utils::simd {
+	template <typename ISA>
+	static auto findCharKernel(const char *data, std::size_t size, char value) noexcept -> const char* {
+		const typename ISA::Vector pattern {ISA::broadcast(value)};
+		std::size_t i {0};
+		for (; i + ISA::WIDTH <= size; i += ISA::WIDTH) {
+			const std::uint32_t mask {ISA::equalMask(ISA::load(data + i), pattern)};
+			if (mask != 0)
+				return data + i + std::countr_zero(mask);
+		}
+
+		for (; i < size; ++i) {
+			if (data[i] == value)
+				return data + i;
+		}
+		return nullptr;
+	}
+
+
+	template <typename ISA>
+	static auto findLastCharKernel(const char *data, std::size_t size, char value) noexcept -> const char* {
+		const typename ISA::Vector pattern {ISA::broadcast(value)};
+		std::size_t end {size};
+		for (; end >= ISA::WIDTH; end -= ISA::WIDTH) {
+			const std::uint32_t mask {ISA::equalMask(ISA::load(data + end - ISA::WIDTH), pattern)};
+			if (mask != 0)
+				return data + end - ISA::WIDTH + std::bit_width(mask) - 1;
+		}
+
+		while (end-- != 0) {
+			if (data[end] == value)
+				return data + end;
+		}
+		return nullptr;
+	}
+
+
+	template <typename ISA>
+	static auto findKernel(const char *data, std::size_t size, const char *pattern, std::size_t patternSize) noexcept -> const char* {
+		if (patternSize == 0)
+			return data;
+		if (patternSize > size)
+			return nullptr;
+		if (patternSize == 1)
+			return findCharKernel<ISA> (data, size, *pattern);
+
+		const typename ISA::Vector first {ISA::broadcast(pattern[0])};
+		const typename ISA::Vector last {ISA::broadcast(pattern[patternSize - 1])};
+		// number of positions the pattern can start at
+		const std::size_t candidateCount {size - patternSize + 1};
+		std::size_t i {0};
+		for (; i + ISA::WIDTH <= candidateCount; i += ISA::WIDTH) {
+			std::uint32_t mask {
+				ISA::equalMask(ISA::load(data + i), first)
+				& ISA::equalMask(ISA::load(data + i + patternSize - 1), last)
+			};
+			while (mask != 0) {
+				const std::size_t position {i + std::countr_zero(mask)};
+				if (std::memcmp(data + position + 1, pattern + 1, patternSize - 2) == 0)
+					return data + position;
+				mask &= mask - 1;
+			}
+		}
+
+		for (; i < candidateCount; ++i) {
+			if (data[i] == pattern[0] && std::memcmp(data + i + 1, pattern + 1, patternSize - 1) == 0)
+				return data + i;
+		}
+		return nullptr;
+	}
+
+
+	template <typename ISA>
+	static auto findLastKernel(const char *data, std::size_t size, const char *pattern, std::size_t patternSize) noexcept -> const char* {
+		if (patternSize == 0)
+			return data + size;
+		if (patternSize > size)
+			return nullptr;
+		if (patternSize == 1)
+			return findLastCharKernel<ISA> (data, size, *pattern);
+
+		const typename ISA::Vector first {ISA::broadcast(pattern[0])};
+		const typename ISA::Vector last {ISA::broadcast(pattern[patternSize - 1])};
+		std::size_t end {size - patternSize + 1};
+		for (; end >= ISA::WIDTH; end -= ISA::WIDTH) {
+			const std::size_t i {end - ISA::WIDTH};
+			std::uint32_t mask {
+				ISA::equalMask(ISA::load(data + i), first)
+				& ISA::equalMask(ISA::load(data + i + patternSize - 1), last)
+			};
+			while (mask != 0) {
+				const std::size_t bit {static_cast<std::size_t> (std::bit_width(mask) - 1)};
+				if (std::memcmp(data + i + bit + 1, pattern + 1, patternSize - 2) == 0)
+					return data + i + bit;
+				mask &= ~(static_cast<std::uint32_t> (1) << bit);
+			}
+		}
+
+		while (end-- != 0) {
+			if (data[end] == pattern[0] && std::memcmp(data + end + 1, pattern + 1, patternSize - 1) == 0)
+				return data + end;
+		}
+		return nullptr;
+	}
+
+
+	template <typename ISA>
+	static auto compareKernel(const char *lhs, const char *rhs, std::size_t size) noexcept -> int {
+		std::size_t i {0};
+		for (; i + ISA::WIDTH <= size; i += ISA::WIDTH) {
+			const std::uint32_t mismatch {~ISA::equalMask(ISA::load(lhs + i), ISA::load(rhs + i)) & ISA::FULL_MASK};
+			if (mismatch != 0) {
+				i += std::countr_zero(mismatch);
+				return static_cast<unsigned char> (lhs[i]) < static_cast<unsigned char> (rhs[i]) ? -1 : 1;
+			}
+		}
+
+		for (; i < size; ++i) {
+			if (lhs[i] != rhs[i])
+				return static_cast<unsigned char> (lhs[i]) < static_cast<unsigned char> (rhs[i]) ? -1 : 1;
+		}
+		return 0;
+	}
+
+} // namespace sl::utils::simd
@@ -0,0 +1,32 @@
+#include "sl/utils/stringToNumber.hpp"
+
+#include <charconv>
+#include <system_error>
+
+
+namespace sl::utils::charconv {
+	template <std::floating_point T>
+	static auto fromChars(const char *str, std::size_t size) noexcept -> std::optional<T> {
+		T value {};
+		const std::from_chars_result result {std::from_chars(str, str + size, value, std::chars_format::general)};
+		if (result.ec != std::errc{} || result.ptr != str + size)
+			return std::nullopt;
+		return value;
+	}
+
+
+	auto toFloat(const char *str, std::size_t size) noexcept -> std::optional<float> {
+		return fromChars<float> (str, size);
+	}
+
+
+	auto toDouble(const char *str, std::size_t size) noexcept -> std::optional<double> {
+		return fromChars<double> (str, size);
+	}
+
+
+	auto toLongDouble(const char *str, std::size_t size) noexcept -> std::optional<long double> {
+		return fromChars<long double> (str, size);
+	}
+
+} // namespace sl::utils::charconv
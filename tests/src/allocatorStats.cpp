@@ -0,0 +1,99 @@
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <sl/memory/allocatorStats.hpp>
+#include <sl/memory/stackAllocator.hpp>
+
+
+using namespace sl::utils::literals;
+
+
+#ifdef SL_MEMORY_STATS
+TEST_CASE("sl::memory::AllocatorStatsRegistry", "[sl::memory::AllocatorStatsRegistry]") {
+	const auto findReport {[](std::string_view name) {
+		auto reports {sl::memory::AllocatorStatsRegistry::getReports()};
+		auto report {std::ranges::find(reports, name, &sl::memory::AllocatorStatsReport::name)};
+		REQUIRE(report != reports.end());
+		return *report;
+	}};
+
+	SECTION("Trackers register and unregister themselves") {
+		const std::size_t reportCount {sl::memory::AllocatorStatsRegistry::getReports().size()};
+		{
+			sl::memory::AllocatorStatsTracker tracker {"test tracker", 1_kiB};
+			REQUIRE(sl::memory::AllocatorStatsRegistry::getReports().size() == reportCount + 1);
+			sl::memory::AllocatorStatsTracker movedTracker {std::move(tracker)};
+			REQUIRE(sl::memory::AllocatorStatsRegistry::getReports().size() == reportCount + 1);
+		}
+		REQUIRE(sl::memory::AllocatorStatsRegistry::getReports().size() == reportCount);
+	}
+
+	SECTION("Stats and frame deltas") {
+		sl::memory::AllocatorStatsTracker tracker {"test tracker", 1_kiB};
+		tracker.onAllocation(64_B);
+		tracker.onAllocation(32_B);
+		tracker.onDeallocation(64_B);
+		tracker.onFailedAllocation();
+
+		auto report {findReport("test tracker")};
+		REQUIRE(report.stats.usedSize == 32_B);
+		REQUIRE(report.stats.peakUsedSize == 96_B);
+		REQUIRE(report.stats.capacity == 1_kiB);
+		REQUIRE(report.stats.allocationCount == 2);
+		REQUIRE(report.stats.deallocationCount == 1);
+		REQUIRE(report.stats.failedAllocationCount == 1);
+
+		sl::memory::AllocatorStatsRegistry::endFrame();
+		tracker.onDeallocation(32_B);
+		report = findReport("test tracker");
+		REQUIRE(report.frameDelta.usedSize == -32);
+		REQUIRE(report.frameDelta.allocationCount == 0);
+		REQUIRE(report.frameDelta.deallocationCount == 1);
+	}
+
+	SECTION("Reports can be taken from another thread") {
+		sl::memory::AllocatorStatsTracker tracker {"telemetry tracker"};
+		std::atomic<bool> isDone {false};
+		std::thread telemetry {[&isDone] {
+			while (!isDone.load(std::memory_order_relaxed)) {
+				(void)sl::memory::AllocatorStatsRegistry::getReports();
+				sl::memory::AllocatorStatsRegistry::endFrame();
+			}
+		}};
+
+		for (std::size_t i {0}; i < 10'000; ++i) {
+			tracker.onAllocation(16_B);
+			tracker.onDeallocation(16_B);
+			(void)tracker.getFrameDelta();
+		}
+		isDone.store(true, std::memory_order_relaxed);
+		telemetry.join();
+
+		const auto report {findReport("telemetry tracker")};
+		REQUIRE(report.stats.allocationCount == 10'000);
+		REQUIRE(report.stats.peakUsedSize == 16_B);
+	}
+
+	SECTION("Allocators report their usage") {
+		sl::memory::StackAllocator stackAllocator {1_kiB};
+		REQUIRE(stackAllocator.allocate(100, 4) != nullptr);
+		REQUIRE(stackAllocator.allocate(2_kiB, 4) == nullptr);
+
+		auto report {findReport("StackAllocator")};
+		REQUIRE(report.stats.usedSize >= 100_B);
+		REQUIRE(report.stats.capacity == 1_kiB);
+		REQUIRE(report.stats.allocationCount == 1);
+		REQUIRE(report.stats.failedAllocationCount == 1);
+	}
+}
+
+#else
+TEST_CASE("sl::memory::AllocatorStatsRegistry", "[sl::memory::AllocatorStatsRegistry]") {
+	sl::memory::StackAllocator stackAllocator {1_kiB};
+	REQUIRE(stackAllocator.allocate(100, 4) != nullptr);
+	REQUIRE(sl::memory::AllocatorStatsRegistry::getReports().empty());
+}
+#endif
@@ -0,0 +1,105 @@
+#include <cstdint>
+#include <memory_resource>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <sl/memory/arenaScope.hpp>
+
+
+using namespace sl::utils::literals;
+
+
+namespace {
+	class CountingMemoryResource final : public std::pmr::memory_resource {
+		public:
+			std::size_t liveCount {0};
+
+		private:
+			auto do_allocate(std::size_t bytes, std::size_t alignment) -> void* override {
+				++liveCount;
+				return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+			}
+			auto do_deallocate(void *ptr, std::size_t bytes, std::size_t alignment) -> void override {
+				--liveCount;
+				std::pmr::new_delete_resource()->deallocate(ptr, bytes, alignment);
+			}
+			auto do_is_equal(const std::pmr::memory_resource &other) const noexcept -> bool override {return this == &other;}
+	};
+}
+
+
+TEST_CASE("sl::memory::ArenaScope", "[sl::memory::ArenaScope]") {
+	sl::memory::StackAllocator stackAllocator {4_kiB};
+	CountingMemoryResource upstream {};
+
+	SECTION("Scopes roll the stack back") {
+		{
+			sl::memory::ArenaScope scope {stackAllocator, upstream};
+			std::pmr::vector<int> values {&scope};
+			values.reserve(100);
+			REQUIRE(stackAllocator.getUsedSize() >= 100 * sizeof(int));
+
+			{
+				sl::memory::ArenaScope nestedScope {stackAllocator, upstream};
+				const std::size_t usedSize {stackAllocator.getUsedSize()};
+				std::pmr::vector<int> nestedValues {&nestedScope};
+				nestedValues.reserve(100);
+				REQUIRE(stackAllocator.getUsedSize() > usedSize);
+			}
+			REQUIRE(stackAllocator.getUsedSize() >= 100 * sizeof(int));
+		}
+		REQUIRE(stackAllocator.getUsedSize() == 0);
+		REQUIRE(upstream.liveCount == 0);
+	}
+
+	SECTION("Overflow falls back to upstream") {
+		sl::memory::ArenaScope scope {stackAllocator, upstream};
+		std::pmr::vector<std::uint64_t> values {&scope};
+		for (std::uint64_t i {0}; i < 10'000; ++i)
+			values.push_back(i);
+		for (std::uint64_t i {0}; i < 10'000; ++i)
+			REQUIRE(values[i] == i);
+
+		REQUIRE(scope.getOverflowCount() != 0);
+		REQUIRE(upstream.liveCount == 1);
+	}
+
+	SECTION("Overflow blocks are freed at scope exit") {
+		{
+			sl::memory::ArenaScope scope {stackAllocator, upstream};
+			REQUIRE(scope.allocate(8_kiB, 16) != nullptr);
+			REQUIRE(scope.allocate(8_kiB, 16) != nullptr);
+			REQUIRE(upstream.liveCount == 2);
+			REQUIRE(scope.getOverflowSize() == 16_kiB);
+		}
+		REQUIRE(upstream.liveCount == 0);
+	}
+}
+
+
+TEST_CASE("sl::memory::ArenaScope : benchmarks", "[sl::memory::ArenaScope][.benchmark]") {
+	static constexpr std::size_t VECTOR_COUNT {64};
+	sl::memory::StackAllocator stackAllocator {1_MiB};
+
+	const auto fillVectors = [](std::pmr::memory_resource &resource) {
+		std::pmr::vector<std::pmr::vector<int>> vectors {&resource};
+		vectors.reserve(VECTOR_COUNT);
+		for (std::size_t i {0}; i < VECTOR_COUNT; ++i) {
+			auto &values {vectors.emplace_back()};
+			values.reserve(16);
+			values.push_back(static_cast<int> (i));
+		}
+		return vectors.back().back();
+	};
+
+	BENCHMARK("64 temporary vectors on the default resource") {
+		return fillVectors(*std::pmr::get_default_resource());
+	};
+
+	BENCHMARK("64 temporary vectors in an ArenaScope") {
+		sl::memory::ArenaScope scope {stackAllocator};
+		return fillVectors(scope);
+	};
+}
@@ -0,0 +1,153 @@
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <sl/memory/concurrentPoolAllocator.hpp>
+
+
+TEST_CASE("sl::memory::ConcurrentPoolAllocator", "[sl::memory::ConcurrentPoolAllocator]") {
+	SECTION("A single thread can use every slot") {
+		sl::memory::ConcurrentPoolAllocator<int> poolAllocator {1000};
+		std::vector<int*> pointers {};
+		for (int i {0}; i < 1000; ++i) {
+			pointers.push_back(poolAllocator.allocate());
+			REQUIRE(pointers.back() != nullptr);
+			*pointers.back() = i;
+		}
+		REQUIRE(poolAllocator.allocate() == nullptr);
+
+		std::vector<int*> sortedPointers {pointers};
+		std::ranges::sort(sortedPointers);
+		REQUIRE(std::ranges::adjacent_find(sortedPointers) == sortedPointers.end());
+
+		for (int i {0}; i < 1000; ++i) {
+			REQUIRE(*pointers[i] == i);
+			poolAllocator.deallocate(pointers[i]);
+		}
+		for (int i {0}; i < 1000; ++i)
+			REQUIRE(poolAllocator.allocate() != nullptr);
+	}
+
+	SECTION("Slots are exchanged between threads") {
+		constexpr std::size_t THREAD_COUNT {8};
+		constexpr std::size_t ROUND_COUNT {200};
+		constexpr std::size_t BLOCK_COUNT {100};
+
+		sl::memory::ConcurrentPoolAllocator<std::size_t> poolAllocator {THREAD_COUNT * BLOCK_COUNT * 4};
+		std::vector<std::atomic<std::size_t*>> mailboxes (BLOCK_COUNT);
+		std::atomic<bool> isCorrupted {false};
+		std::vector<std::thread> threads {};
+
+		for (std::size_t threadIndex {0}; threadIndex < THREAD_COUNT; ++threadIndex) {
+			threads.emplace_back([&, threadIndex] {
+				for (std::size_t round {0}; round < ROUND_COUNT; ++round) {
+					for (std::size_t i {0}; i < BLOCK_COUNT; ++i) {
+						std::size_t *pointer {poolAllocator.allocate()};
+						if (pointer == nullptr) {
+							isCorrupted = true;
+							return;
+						}
+						*pointer = threadIndex * BLOCK_COUNT + i;
+
+						// the mailboxes are shared, so most blocks are freed by another thread than the one that allocated them
+						std::size_t *received {mailboxes[i].exchange(pointer)};
+						if (received == nullptr)
+							continue;
+						if (*received % BLOCK_COUNT != i)
+							isCorrupted = true;
+						poolAllocator.deallocate(received);
+					}
+				}
+			});
+		}
+
+		for (auto &thread : threads)
+			thread.join();
+		REQUIRE(!isCorrupted);
+	}
+
+	SECTION("Threads give their cached slots back before exiting") {
+		constexpr std::size_t THREAD_COUNT {4};
+		constexpr std::size_t BLOCK_COUNT {64};
+
+		sl::memory::ConcurrentPoolAllocator<int> poolAllocator {THREAD_COUNT * BLOCK_COUNT};
+		std::vector<std::thread> threads {};
+		for (std::size_t threadIndex {0}; threadIndex < THREAD_COUNT; ++threadIndex) {
+			threads.emplace_back([&poolAllocator] {
+				std::vector<int*> pointers {};
+				for (std::size_t i {0}; i < BLOCK_COUNT; ++i)
+					pointers.push_back(poolAllocator.allocate());
+				for (int *pointer : pointers)
+					poolAllocator.deallocate(pointer);
+				poolAllocator.flushThreadCache();
+			});
+		}
+		for (auto &thread : threads)
+			thread.join();
+
+		for (std::size_t i {0}; i < THREAD_COUNT * BLOCK_COUNT; ++i)
+			REQUIRE(poolAllocator.allocate() != nullptr);
+		REQUIRE(poolAllocator.allocate() == nullptr);
+	}
+
+	SECTION("Copies share their slots") {
+		sl::memory::ConcurrentPoolAllocator<int> poolAllocator {1};
+		sl::memory::ConcurrentPoolAllocator<int> copy {poolAllocator};
+		REQUIRE(copy == poolAllocator);
+		int *pointer {poolAllocator.allocate()};
+		REQUIRE(copy.allocate() == nullptr);
+		copy.deallocate(pointer);
+		REQUIRE(poolAllocator.allocate() == pointer);
+	}
+
+	SECTION("Assignments release the previous slots") {
+		sl::memory::ConcurrentPoolAllocator<int> poolAllocator {4};
+		(void)poolAllocator.allocate();
+		sl::memory::ConcurrentPoolAllocator<int> other {1};
+		int *pointer {other.allocate()};
+
+		poolAllocator = std::move(other);
+		REQUIRE(poolAllocator.allocate() == nullptr);
+		poolAllocator.deallocate(pointer);
+
+		sl::memory::ConcurrentPoolAllocator<int> copy {8};
+		copy = poolAllocator;
+		REQUIRE(copy == poolAllocator);
+		REQUIRE(copy.allocate() == pointer);
+	}
+}
+
+
+TEST_CASE("sl::memory::ConcurrentPoolAllocator : benchmarks", "[sl::memory::ConcurrentPoolAllocator][.benchmark]") {
+	static constexpr std::size_t OPERATION_COUNT {1'000'000};
+	static constexpr std::size_t LIVE_BLOCK_COUNT {256};
+
+	for (std::size_t threadCount : {1, 2, 4, 8, 16, 32}) {
+		BENCHMARK_ADVANCED("1M allocate/deallocate pairs per thread with " + std::to_string(threadCount) + " threads")(Catch::Benchmark::Chronometer meter) {
+			sl::memory::ConcurrentPoolAllocator<std::uint64_t> poolAllocator {threadCount * LIVE_BLOCK_COUNT * 2};
+
+			meter.measure([&] {
+				std::vector<std::thread> threads {};
+				for (std::size_t i {0}; i < threadCount; ++i) {
+					threads.emplace_back([&poolAllocator] {
+						std::vector<std::uint64_t*> pointers (LIVE_BLOCK_COUNT, nullptr);
+						for (std::size_t j {0}; j < OPERATION_COUNT; ++j) {
+							std::uint64_t *&pointer {pointers[j % LIVE_BLOCK_COUNT]};
+							poolAllocator.deallocate(pointer);
+							pointer = poolAllocator.allocate();
+						}
+						for (std::uint64_t *pointer : pointers)
+							poolAllocator.deallocate(pointer);
+						poolAllocator.flushThreadCache();
+					});
+				}
+				for (auto &thread : threads)
+					thread.join();
+			});
+		};
+	}
+}
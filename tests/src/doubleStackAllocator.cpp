@@ -0,0 +1,43 @@
+#include <cstdint>
+#include <cstring>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <sl/memory/doubleStackAllocator.hpp>
+
+
+using namespace sl::utils::literals;
+
+
+TEST_CASE("sl::memory::DoubleStackAllocator", "[sl::memory::DoubleStackAllocator]") {
+	sl::memory::DoubleStackAllocator allocator {1_kiB};
+
+	SECTION("Top stack allocations are aligned and don't overlap") {
+		std::byte *first {allocator.allocate(3, 1, sl::memory::DoubleStackSide::eTop)};
+		std::byte *second {allocator.allocate(16, 16, sl::memory::DoubleStackSide::eTop)};
+		REQUIRE(first != nullptr);
+		REQUIRE(second != nullptr);
+		REQUIRE(reinterpret_cast<std::uintptr_t> (second) % 16 == 0);
+		REQUIRE(second + 16 <= first);
+		std::memset(second, 0, 16);
+		std::memset(first, 1, 3);
+		REQUIRE(second[15] == std::byte{0});
+	}
+
+	SECTION("Stacks don't collide") {
+		REQUIRE(allocator.allocate(600, 1, sl::memory::DoubleStackSide::eBottom) != nullptr);
+		REQUIRE(allocator.allocate(600, 1, sl::memory::DoubleStackSide::eTop) == nullptr);
+		REQUIRE(allocator.allocate(400, 1, sl::memory::DoubleStackSide::eTop) != nullptr);
+		REQUIRE(allocator.getFreeSize() == 24);
+	}
+
+	SECTION("Move assignment releases the previous stacks") {
+		REQUIRE(allocator.allocate(600, 1, sl::memory::DoubleStackSide::eBottom) != nullptr);
+		sl::memory::DoubleStackAllocator other {2_kiB};
+		REQUIRE(other.allocate(100, 1, sl::memory::DoubleStackSide::eTop) != nullptr);
+
+		allocator = std::move(other);
+		REQUIRE(allocator.getFreeSize() == 2_kiB - 100_B);
+		REQUIRE(allocator.allocate(1_kiB, 1, sl::memory::DoubleStackSide::eBottom) != nullptr);
+	}
+}
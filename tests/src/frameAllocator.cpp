@@ -0,0 +1,61 @@
+#include <new>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <sl/memory/frameAllocator.hpp>
+
+
+using namespace sl::utils::literals;
+
+
+TEST_CASE("sl::memory::FrameAllocator", "[sl::memory::FrameAllocator]") {
+	sl::memory::FrameAllocator frameAllocator {sl::memory::FrameAllocatorCreateInfos{
+		.frameCount = 3,
+		.arena = {.size = 1_kiB}
+	}};
+	REQUIRE(frameAllocator.getFrameCount() == 3);
+
+	SECTION("Frames are only reused once retired") {
+		std::byte *frames[3] {};
+		for (std::uint64_t i {0}; i < 3; ++i) {
+			frames[i] = frameAllocator.allocate(64, 8);
+			REQUIRE(frames[i] != nullptr);
+			frameAllocator.endFrame(i + 1);
+		}
+
+		REQUIRE(!frameAllocator.isCurrentFrameAvailable());
+
+		frameAllocator.signalCompletion(1);
+		REQUIRE(frameAllocator.isCurrentFrameAvailable());
+		REQUIRE(frameAllocator.allocate(64, 8) == frames[0]);
+		frameAllocator.endFrame(4);
+
+		REQUIRE(!frameAllocator.isCurrentFrameAvailable());
+		frameAllocator.signalCompletion(3);
+		REQUIRE(frameAllocator.isCurrentFrameAvailable());
+		REQUIRE(frameAllocator.allocate(64, 8) == frames[1]);
+	}
+
+	SECTION("Peak usage") {
+		(void)frameAllocator.allocate(100, 1);
+		(void)frameAllocator.allocate(200, 1);
+		REQUIRE(frameAllocator.getCurrentFrameUsage() == 300_B);
+		frameAllocator.endFrame(1);
+		REQUIRE(frameAllocator.getLastFramePeakUsage() == 300_B);
+
+		(void)frameAllocator.allocate(50, 1);
+		frameAllocator.endFrame(2);
+		REQUIRE(frameAllocator.getLastFramePeakUsage() == 50_B);
+		REQUIRE(frameAllocator.getPeakUsage() == 300_B);
+	}
+
+	SECTION("Memory resource throws when the frame is full or in flight") {
+		sl::memory::FrameMemoryResource frameMemoryResource {frameAllocator};
+		REQUIRE(frameMemoryResource.allocate(512, 8) != nullptr);
+		REQUIRE_THROWS_AS(frameMemoryResource.allocate(1_kiB, 8), std::bad_alloc);
+
+		for (std::uint64_t i {0}; i < 3; ++i)
+			frameAllocator.endFrame(i + 1);
+		REQUIRE_THROWS_AS(frameMemoryResource.allocate(8, 8), std::bad_alloc);
+	}
+}
@@ -0,0 +1,124 @@
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <unordered_set>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <sl/memory/handleTable.hpp>
+
+
+TEST_CASE("sl::memory::HandleTable", "[sl::memory::HandleTable]") {
+	sl::memory::HandleTable<int> handleTable {4};
+
+	SECTION("Creation and lookup") {
+		REQUIRE(sl::memory::Handle<int> {}.isNull());
+		REQUIRE(!handleTable.isValid(sl::memory::Handle<int> {}));
+
+		auto first {handleTable.create(1)};
+		auto second {handleTable.create(2)};
+		REQUIRE(!first.isNull());
+		REQUIRE(first != second);
+		REQUIRE(handleTable.getSize() == 2);
+		REQUIRE(*handleTable.get(first) == 1);
+		REQUIRE(*handleTable.get(second) == 2);
+	}
+
+	SECTION("Stale handles don't alias new objects") {
+		auto first {handleTable.create(1)};
+		REQUIRE(handleTable.destroy(first));
+		REQUIRE(!handleTable.destroy(first));
+
+		auto second {handleTable.create(2)};
+		REQUIRE(second.getIndex() == first.getIndex());
+		REQUIRE(second.getGeneration() != first.getGeneration());
+		REQUIRE(!handleTable.isValid(first));
+		REQUIRE(handleTable.get(first) == nullptr);
+		REQUIRE(*handleTable.get(second) == 2);
+	}
+
+	SECTION("Batch destroy and iteration across chunks") {
+		std::vector<sl::memory::Handle<int>> handles {};
+		for (int i {0}; i < 100; ++i)
+			handles.push_back(handleTable.create(i));
+
+		std::vector<sl::memory::Handle<int>> odd {};
+		for (std::size_t i {1}; i < handles.size(); i += 2)
+			odd.push_back(handles[i]);
+		odd.push_back(handles[1]);
+		REQUIRE(handleTable.destroy(odd) == 50);
+		REQUIRE(handleTable.getSize() == 50);
+
+		std::vector<int> values (handleTable.begin(), handleTable.end());
+		std::ranges::sort(values);
+		REQUIRE(values.size() == 50);
+		for (std::size_t i {0}; i < values.size(); ++i)
+			REQUIRE(values[i] == static_cast<int> (2 * i));
+	}
+
+	SECTION("Objects are destroyed with the table") {
+		auto counter {std::make_shared<int> (0)};
+		{
+			sl::memory::HandleTable<std::shared_ptr<int>> sharedTable {};
+			auto handle {sharedTable.create(counter)};
+			(void)sharedTable.create(counter);
+			REQUIRE(counter.use_count() == 3);
+			sharedTable.destroy(handle);
+			REQUIRE(counter.use_count() == 2);
+		}
+		REQUIRE(counter.use_count() == 1);
+	}
+
+	SECTION("Handles can be hashed") {
+		std::unordered_set<sl::memory::Handle<int>> handles {};
+		for (int i {0}; i < 10; ++i)
+			handles.insert(handleTable.create(i));
+		REQUIRE(handles.size() == 10);
+	}
+
+	SECTION("Move assignment destroys the previous objects") {
+		auto counter {std::make_shared<int> (0)};
+		sl::memory::HandleTable<std::shared_ptr<int>> sharedTable {4};
+		(void)sharedTable.create(counter);
+		(void)sharedTable.create(counter);
+		sl::memory::HandleTable<std::shared_ptr<int>> other {4};
+		auto handle {other.create(counter)};
+		REQUIRE(counter.use_count() == 4);
+
+		sharedTable = std::move(other);
+		REQUIRE(counter.use_count() == 2);
+		REQUIRE(sharedTable.getSize() == 1);
+		REQUIRE(other.getSize() == 0);
+		REQUIRE(*sharedTable.get(handle) == counter);
+		REQUIRE(sharedTable.destroy(handle));
+		REQUIRE(counter.use_count() == 1);
+	}
+}
+
+
+TEST_CASE("sl::memory::HandleTable : benchmarks", "[sl::memory::HandleTable][.benchmark]") {
+	static constexpr std::size_t HANDLE_COUNT {100'000};
+
+	sl::memory::HandleTable<std::uint64_t> handleTable {4096};
+	std::vector<sl::memory::Handle<std::uint64_t>> handles {};
+	handles.reserve(HANDLE_COUNT);
+	for (std::size_t i {0}; i < HANDLE_COUNT; ++i)
+		handles.push_back(handleTable.create(i));
+	std::ranges::shuffle(handles, std::mt19937_64 {42});
+
+	BENCHMARK("Look up 100k random handles") {
+		std::uint64_t sum {0};
+		for (const auto &handle : handles)
+			sum += *handleTable.get(handle);
+		return sum;
+	};
+
+	BENCHMARK("Iterate over 100k objects") {
+		std::uint64_t sum {0};
+		for (const auto value : handleTable)
+			sum += value;
+		return sum;
+	};
+}
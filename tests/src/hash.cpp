@@ -0,0 +1,144 @@
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <sl/utils/hash.hpp>
+
+using namespace sl::utils::literals;
+
+
+static constexpr auto makeLongInput() noexcept -> std::array<char, 1000> {
+	std::array<char, 1000> input {};
+	for (std::size_t i {0}; i < input.size(); ++i)
+		input[i] = static_cast<char>('a' + (i * 7) % 26);
+	return input;
+}
+
+static constexpr std::array<char, 1000> LONG_INPUT {makeLongInput()};
+static constexpr sl::utils::Hash64 LONG_INPUT_HASH {sl::utils::hash<sl::utils::Hash64> (LONG_INPUT.data(), LONG_INPUT.size())};
+
+
+// Identifiers shaped like the ones the engine hashes: event categories, file paths and asset names
+static auto makeNameCorpus() -> std::vector<std::string> {
+	static const char *const MODULES[] {"sl", "window", "input", "render", "audio", "physics", "script", "asset", "ui", "net"};
+	static const char *const WORDS[] {
+		"key", "mouse", "button", "down", "up", "move", "resize", "close", "focus", "texture", "mesh", "shader",
+		"material", "sound", "player", "enemy", "level", "camera", "light", "shadow", "frame", "begin", "end", "load"
+	};
+	std::vector<std::string> names {};
+	for (const char *module : MODULES) {
+		for (const char *first : WORDS) {
+			for (const char *second : WORDS) {
+				names.push_back(std::string{module} + "_" + first + second);
+				for (std::size_t i {0}; i < 40; ++i)
+					names.push_back("assets/" + std::string{module} + "/" + first + "_" + second + "_" + std::to_string(i) + ".bin");
+			}
+		}
+	}
+	return names;
+}
+
+
+TEST_CASE("sl::utils::hash", "[sl::utils::hash]") {
+	SECTION("Compile time and runtime agree") {
+		static_assert("sl_keydown"_hash64 == "sl_keydown"_hash64);
+		static_assert("sl_keydown"_hash64 != "sl_keyup"_hash64);
+		static_assert(""_hash32 != "\0"_hash32);
+
+		std::string input {};
+		for (std::size_t size {0}; size <= 1000; ++size) {
+			const sl::utils::Hash64 runtime {sl::utils::hash<sl::utils::Hash64> (input.data(), input.size())};
+			REQUIRE(runtime == sl::utils::hash<sl::utils::Hash64> (sl::String{input.c_str()}));
+			input.push_back(static_cast<char> ('a' + (size * 7) % 26));
+		}
+
+		REQUIRE(sl::utils::hash<sl::utils::Hash64> ("sl_keydown", 10) == "sl_keydown"_hash64);
+		std::string longInput {LONG_INPUT.data(), LONG_INPUT.size()};
+		REQUIRE(sl::utils::hash<sl::utils::Hash64> (longInput.data(), longInput.size()) == LONG_INPUT_HASH);
+	}
+
+	SECTION("Vectorized and scalar accumulation agree") {
+		std::mt19937_64 random {42};
+		for (std::size_t size : {257uz, 320uz, 1000uz, 1024uz, 4096uz, 65536uz + 13}) {
+			std::string input (size, '\0');
+			for (auto &character : input)
+				character = static_cast<char> (random());
+
+			std::uint64_t vectorized[8] {};
+			std::uint64_t scalar[8] {};
+			for (std::size_t lane {0}; lane < 8; ++lane)
+				vectorized[lane] = scalar[lane] = sl::utils::simd::HASH_LONG_INIT[lane];
+			sl::utils::simd::hashAccumulate(input.data(), input.size(), vectorized);
+			sl::utils::__hash_accumulate(input.data(), input.size(), scalar);
+			for (std::size_t lane {0}; lane < 8; ++lane)
+				REQUIRE(vectorized[lane] == scalar[lane]);
+		}
+	}
+
+	SECTION("Order and length sensitivity") {
+		REQUIRE("listen"_hash64 != "silent"_hash64);
+		REQUIRE("abcdefgh12345678"_hash64 != "12345678abcdefgh"_hash64);
+		REQUIRE("a"_hash64 != "a\0"_hash64);
+
+		// swapping two stripes of a long input must change the hash
+		std::string input {LONG_INPUT.data(), LONG_INPUT.size()};
+		std::swap_ranges(input.begin(), input.begin() + 64, input.begin() + 64);
+		REQUIRE(sl::utils::hash<sl::utils::Hash64> (input.data(), input.size()) != LONG_INPUT_HASH);
+	}
+
+	SECTION("Collisions over a name corpus") {
+		const std::vector<std::string> names {makeNameCorpus()};
+		std::unordered_set<std::string> uniqueNames {names.begin(), names.end()};
+		REQUIRE(uniqueNames.size() == names.size());
+
+		std::unordered_set<std::uint64_t> hashes64 {};
+		std::unordered_set<std::uint32_t> hashes32 {};
+		for (const auto &name : names) {
+			hashes64.insert(static_cast<std::uint64_t> (sl::utils::hash<sl::utils::Hash64> (name.data(), name.size())));
+			hashes32.insert(static_cast<std::uint32_t> (sl::utils::hash<sl::utils::Hash32> (name.data(), name.size())));
+		}
+		REQUIRE(hashes64.size() == names.size());
+		// about 2.7 collisions are expected from a perfect 32-bit hash over the ~236k names of the corpus
+		REQUIRE(names.size() - hashes32.size() <= 16);
+	}
+}
+
+
+TEST_CASE("sl::utils::hash : benchmarks", "[sl::utils::hash][.benchmark]") {
+	std::string large (1 << 20, '\0');
+	std::mt19937_64 random {42};
+	for (auto &character : large)
+		character = static_cast<char> (random());
+	const std::vector<std::string> names {makeNameCorpus()};
+
+	BENCHMARK("Hash 1 MiB") {
+		return sl::utils::hash<sl::utils::Hash64> (large.data(), large.size());
+	};
+
+	BENCHMARK("Hash 1 MiB with std::hash<std::string_view>") {
+		return std::hash<std::string_view> {} (large);
+	};
+
+	BENCHMARK("Hash the ~236k names of the corpus") {
+		std::uint64_t sum {0};
+		for (const auto &name : names)
+			sum += static_cast<std::uint64_t> (sl::utils::hash<sl::utils::Hash64> (name.data(), name.size()));
+		return sum;
+	};
+
+	BENCHMARK("Hash the ~236k names of the corpus with std::hash<std::string_view>") {
+		std::uint64_t sum {0};
+		for (const auto &name : names)
+			sum += std::hash<std::string_view> {} (name);
+		return sum;
+	};
+}
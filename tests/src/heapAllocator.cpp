@@ -0,0 +1,278 @@
+#include <algorithm>
+#include <new>
+#include <random>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <sl/memory/heapAllocator.hpp>
+
+
+using namespace sl::utils::literals;
+
+
+TEST_CASE("sl::memory::HeapAllocator", "[sl::memory::HeapAllocator]") {
+	sl::memory::HeapAllocator heapAllocator {1_MiB, 2, 32_B};
+
+	SECTION("Allocation and deallocation") {
+		auto first {static_cast<sl::memory::HeapAllocatorPointer<int>> (heapAllocator.allocate(sizeof(int) * 4, alignof(int)))};
+		auto second {static_cast<sl::memory::HeapAllocatorPointer<int>> (heapAllocator.allocate(sizeof(int) * 4, alignof(int)))};
+		REQUIRE(first != nullptr);
+		REQUIRE(second != nullptr);
+		REQUIRE(&*second - &*first >= 4);
+
+		for (int i {0}; i < 4; ++i) {
+			first[i] = i;
+			second[i] = -i;
+		}
+
+		heapAllocator.deallocate(static_cast<sl::memory::HeapAllocator::pointer> (first));
+		auto third {static_cast<sl::memory::HeapAllocatorPointer<int>> (heapAllocator.allocate(sizeof(int) * 2, alignof(int)))};
+		REQUIRE(&*third < &*second);
+		for (int i {0}; i < 4; ++i)
+			REQUIRE(second[i] == -i);
+	}
+
+	SECTION("Defragmentation keeps handles valid") {
+		std::vector<sl::memory::HeapAllocator::pointer> handles {};
+		for (std::size_t i {0}; i < 64; ++i) {
+			handles.push_back(heapAllocator.allocate(16, 8));
+			REQUIRE(handles.back() != nullptr);
+			std::ranges::fill_n(&*handles.back(), 16, static_cast<std::byte> (i));
+		}
+
+		for (std::size_t i {0}; i < handles.size(); i += 2)
+			heapAllocator.deallocate(handles[i]);
+
+		std::byte *lastAddress {&*handles.back()};
+		heapAllocator.defragment(handles.size());
+		REQUIRE(&*handles.back() < lastAddress);
+
+		for (std::size_t i {1}; i < handles.size(); i += 2) {
+			REQUIRE(reinterpret_cast<std::uintptr_t> (&*handles[i]) % 8 == 0);
+			REQUIRE(std::ranges::all_of(&*handles[i], &*handles[i] + 16, [i](std::byte value) {return value == static_cast<std::byte> (i);}));
+		}
+	}
+
+	SECTION("Defragmentation respects its budget and resumes") {
+		std::vector<sl::memory::HeapAllocator::pointer> handles {};
+		for (std::size_t i {0}; i < 64; ++i)
+			handles.push_back(heapAllocator.allocate(16, 8));
+		for (std::size_t i {0}; i < handles.size(); i += 2)
+			heapAllocator.deallocate(handles[i]);
+
+		auto report {heapAllocator.defragment(sl::memory::HeapDefragmentationBudget{.maxRelocationCount = 8})};
+		REQUIRE(report.relocationCount == 8);
+		REQUIRE(!report.isPassComplete);
+
+		report = heapAllocator.defragment(sl::memory::HeapDefragmentationBudget{.measureFragmentation = true});
+		REQUIRE(report.relocationCount == 24);
+		REQUIRE(report.isPassComplete);
+		REQUIRE(report.fragmentation.pages.size() == 1);
+		REQUIRE(report.fragmentation.largestFreeRange == report.fragmentation.freeSize);
+
+		report = heapAllocator.defragment(sl::memory::HeapDefragmentationBudget{});
+		REQUIRE(report.relocationCount == 0);
+		REQUIRE(report.fragmentation.pages.empty());
+	}
+
+	SECTION("Defragmentation releases empty pages") {
+		constexpr std::size_t HALF_PAGE_SIZE {512 * 1024};
+		auto first {heapAllocator.allocate(HALF_PAGE_SIZE)};
+		auto second {heapAllocator.allocate(HALF_PAGE_SIZE + 1)};
+		REQUIRE(first != nullptr);
+		REQUIRE(second != nullptr);
+		REQUIRE(heapAllocator.getFragmentation().pages.size() == 2);
+
+		heapAllocator.deallocate(second);
+		auto report {heapAllocator.defragment(sl::memory::HeapDefragmentationBudget{.measureFragmentation = true})};
+		REQUIRE(report.releasedPageCount == 1);
+		REQUIRE(report.fragmentation.pages.size() == 1);
+		REQUIRE(heapAllocator.allocate(HALF_PAGE_SIZE + 1) != nullptr);
+	}
+
+	SECTION("Random allocations never overlap") {
+		struct Block {
+			sl::memory::HeapAllocator::pointer handle;
+			std::size_t size;
+			std::byte value;
+		};
+
+		std::mt19937_64 randomEngine {42};
+		std::uniform_int_distribution<std::size_t> sizeDistribution {1, 512};
+		std::uniform_int_distribution<std::size_t> alignmentDistribution {0, 4};
+		std::vector<Block> blocks {};
+
+		for (std::size_t i {0}; i < 4096; ++i) {
+			if (!blocks.empty() && randomEngine() % 3 == 0) {
+				std::size_t index {randomEngine() % blocks.size()};
+				heapAllocator.deallocate(blocks[index].handle);
+				blocks[index] = blocks.back();
+				blocks.pop_back();
+				continue;
+			}
+
+			std::size_t size {sizeDistribution(randomEngine)};
+			std::size_t alignment {static_cast<std::size_t> (1) << alignmentDistribution(randomEngine)};
+			auto handle {heapAllocator.allocate(size, alignment)};
+			REQUIRE(handle != nullptr);
+			REQUIRE(reinterpret_cast<std::uintptr_t> (&*handle) % alignment == 0);
+			std::ranges::fill_n(&*handle, size, static_cast<std::byte> (i));
+			blocks.push_back({handle, size, static_cast<std::byte> (i)});
+
+			if (i % 1024 == 0)
+				heapAllocator.defragment(64);
+		}
+
+		for (const auto &block : blocks)
+			REQUIRE(std::ranges::all_of(&*block.handle, &*block.handle + block.size, [&block](std::byte value) {return value == block.value;}));
+	}
+
+	SECTION("Memory resource") {
+		sl::memory::HeapMemoryResource heapMemoryResource {heapAllocator};
+		void *ptr {heapMemoryResource.allocate(64, 16)};
+		REQUIRE(ptr != nullptr);
+		REQUIRE(reinterpret_cast<std::uintptr_t> (ptr) % 16 == 0);
+		heapMemoryResource.deallocate(ptr, 64, 16);
+		REQUIRE(heapMemoryResource.allocate(64, 16) == ptr);
+	}
+
+	SECTION("Memory resource throws when the heap is full") {
+		constexpr std::size_t HALF_PAGE_SIZE {512 * 1024};
+		sl::memory::HeapMemoryResource heapMemoryResource {heapAllocator};
+		REQUIRE(heapMemoryResource.allocate(HALF_PAGE_SIZE + 1, 1) != nullptr);
+		REQUIRE(heapMemoryResource.allocate(HALF_PAGE_SIZE + 1, 1) != nullptr);
+		REQUIRE_THROWS_AS(heapMemoryResource.allocate(HALF_PAGE_SIZE + 1, 1), std::bad_alloc);
+	}
+
+	SECTION("Memory resource after defragmentation") {
+		sl::memory::HeapMemoryResource heapMemoryResource {heapAllocator};
+		std::byte *first {static_cast<std::byte*> (heapMemoryResource.allocate(64, 16))};
+		auto handle {heapAllocator.allocate(64, 16)};
+		std::byte *second {static_cast<std::byte*> (heapMemoryResource.allocate(64, 16))};
+		REQUIRE(second == first + 128);
+
+		heapAllocator.deallocate(handle);
+		heapAllocator.defragment(sl::memory::HeapDefragmentationBudget{});
+		heapMemoryResource.deallocate(first + 64, 64, 16);
+		REQUIRE(heapMemoryResource.allocate(64, 16) == first + 64);
+	}
+
+	SECTION("Memory resource finds every allocation after random defragmentations") {
+		sl::memory::HeapMemoryResource heapMemoryResource {heapAllocator};
+		std::mt19937_64 randomEngine {42};
+		std::uniform_int_distribution<std::size_t> sizeDistribution {1, 256};
+		std::vector<sl::memory::HeapAllocator::pointer> handles {};
+
+		for (std::size_t i {0}; i < 4096; ++i) {
+			if (!handles.empty() && randomEngine() % 3 == 0) {
+				const std::size_t index {randomEngine() % handles.size()};
+				heapMemoryResource.deallocate(&*handles[index], 1, 1);
+				handles[index] = handles.back();
+				handles.pop_back();
+			}
+			else
+				handles.push_back(heapAllocator.allocate(sizeDistribution(randomEngine), static_cast<std::size_t> (1) << (randomEngine() % 5)));
+
+			if (i % 512 == 0)
+				heapAllocator.defragment(32);
+		}
+
+		heapAllocator.defragment(sl::memory::HeapDefragmentationBudget{});
+		for (const auto &handle : handles)
+			heapMemoryResource.deallocate(&*handle, 1, 1);
+		REQUIRE(heapAllocator.defragment(sl::memory::HeapDefragmentationBudget{.measureFragmentation = true}).fragmentation.freeRatio == 1.f);
+	}
+
+	SECTION("Move assignment releases the previous pages") {
+		(void)heapAllocator.allocate(64, 16);
+		sl::memory::HeapAllocator other {1_MiB, 2, 32_B};
+		auto handle {static_cast<sl::memory::HeapAllocatorPointer<int>> (other.allocate(sizeof(int), alignof(int)))};
+		*handle = 42;
+
+		heapAllocator = std::move(other);
+		REQUIRE(*handle == 42);
+		heapAllocator.deallocate(static_cast<sl::memory::HeapAllocator::pointer> (handle));
+		REQUIRE(heapAllocator.allocate(64, 16) != nullptr);
+	}
+
+	SECTION("Defragmenting a moved-from allocator does nothing") {
+		(void)heapAllocator.allocate(64, 16);
+		const sl::memory::HeapAllocator other {std::move(heapAllocator)};
+		const auto report {heapAllocator.defragment(sl::memory::HeapDefragmentationBudget{})};
+		REQUIRE(report.relocationCount == 0);
+		REQUIRE(report.releasedPageCount == 0);
+		REQUIRE(report.fragmentation.pages.empty());
+		heapAllocator.defragment();
+	}
+}
+
+
+TEST_CASE("sl::memory::HeapAllocator : benchmarks", "[sl::memory::HeapAllocator][.benchmark]") {
+	constexpr std::size_t HANDLE_COUNT {100'000};
+
+	BENCHMARK_ADVANCED("Deallocate 100k random handles")(Catch::Benchmark::Chronometer meter) {
+		std::mt19937_64 randomEngine {42};
+		std::uniform_int_distribution<std::size_t> sizeDistribution {8, 64};
+		std::vector<sl::memory::HeapAllocator> heapAllocators {};
+		std::vector<std::vector<sl::memory::HeapAllocator::pointer>> handles (meter.runs());
+
+		heapAllocators.reserve(meter.runs());
+		for (auto &runHandles : handles) {
+			auto &heapAllocator {heapAllocators.emplace_back(8_MiB, 4, 32_B)};
+			runHandles.reserve(HANDLE_COUNT);
+			for (std::size_t i {0}; i < HANDLE_COUNT; ++i)
+				runHandles.push_back(heapAllocator.allocate(sizeDistribution(randomEngine), 8));
+			std::ranges::shuffle(runHandles, randomEngine);
+		}
+
+		meter.measure([&heapAllocators, &handles](int run) {
+			for (const auto &handle : handles[run])
+				heapAllocators[run].deallocate(handle);
+		});
+	};
+
+	BENCHMARK_ADVANCED("Deallocate 100k random raw pointers through HeapMemoryResource")(Catch::Benchmark::Chronometer meter) {
+		std::mt19937_64 randomEngine {42};
+		std::uniform_int_distribution<std::size_t> sizeDistribution {8, 64};
+		std::vector<sl::memory::HeapAllocator> heapAllocators {};
+		std::vector<std::vector<void*>> pointers (meter.runs());
+
+		heapAllocators.reserve(meter.runs());
+		for (auto &runPointers : pointers) {
+			sl::memory::HeapMemoryResource heapMemoryResource {heapAllocators.emplace_back(8_MiB, 4, 32_B)};
+			runPointers.reserve(HANDLE_COUNT);
+			for (std::size_t i {0}; i < HANDLE_COUNT; ++i)
+				runPointers.push_back(heapMemoryResource.allocate(sizeDistribution(randomEngine), 8));
+			std::ranges::shuffle(runPointers, randomEngine);
+		}
+
+		meter.measure([&heapAllocators, &pointers](int run) {
+			sl::memory::HeapMemoryResource heapMemoryResource {heapAllocators[run]};
+			for (void *ptr : pointers[run])
+				heapMemoryResource.deallocate(ptr, 8, 8);
+		});
+	};
+
+	BENCHMARK_ADVANCED("Allocate with 100k live blocks")(Catch::Benchmark::Chronometer meter) {
+		std::mt19937_64 randomEngine {42};
+		std::uniform_int_distribution<std::size_t> sizeDistribution {8, 64};
+		sl::memory::HeapAllocator heapAllocator {8_MiB, 4, 32_B};
+		std::vector<sl::memory::HeapAllocator::pointer> handles {};
+
+		handles.reserve(HANDLE_COUNT);
+		for (std::size_t i {0}; i < HANDLE_COUNT; ++i)
+			handles.push_back(heapAllocator.allocate(sizeDistribution(randomEngine), 8));
+		std::ranges::shuffle(handles, randomEngine);
+		for (std::size_t i {0}; i < HANDLE_COUNT / 2; ++i)
+			heapAllocator.deallocate(handles[i]);
+
+		std::vector<std::size_t> sizes (meter.runs());
+		std::ranges::generate(sizes, [&] {return sizeDistribution(randomEngine);});
+		std::vector<sl::memory::HeapAllocator::pointer> newHandles (meter.runs());
+		meter.measure([&heapAllocator, &sizes, &newHandles](int run) {
+			newHandles[run] = heapAllocator.allocate(sizes[run], 8);
+		});
+	};
+}
@@ -0,0 +1,60 @@
+#include <memory_resource>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <sl/memory/levelArena.hpp>
+
+
+using namespace sl::utils::literals;
+
+
+TEST_CASE("sl::memory::LevelArena", "[sl::memory::LevelArena]") {
+	sl::memory::LevelArena arena {4_kiB};
+
+	SECTION("Persistent and scratch sides") {
+		std::pmr::vector<int> level {&arena.getPersistentResource()};
+		std::pmr::vector<int> scratch {&arena.getScratchResource()};
+		level.reserve(100);
+		scratch.reserve(100);
+		REQUIRE(level.data() < scratch.data());
+		REQUIRE(arena.getFreeSize() <= 4_kiB - 2 * 100 * sizeof(int));
+
+		const sl::utils::Bytes freeSize {arena.getFreeSize()};
+		arena.releaseScratch();
+		REQUIRE(arena.getFreeSize() >= freeSize + 100 * sizeof(int));
+		arena.reset();
+		REQUIRE(arena.getFreeSize() == 4_kiB);
+	}
+
+	SECTION("Promotion copies scratch data down") {
+		int *scratch {reinterpret_cast<int*> (arena.allocateScratch(sizeof(int) * 16, alignof(int)))};
+		for (int i {0}; i < 16; ++i)
+			scratch[i] = i;
+
+		int *persistent {reinterpret_cast<int*> (arena.promote(scratch, sizeof(int) * 16, alignof(int)))};
+		arena.releaseScratch();
+		REQUIRE(persistent != nullptr);
+		for (int i {0}; i < 16; ++i)
+			REQUIRE(persistent[i] == i);
+	}
+
+	SECTION("Collisions are reported") {
+		std::size_t callbackCount {0};
+		arena.setCollisionCallback([&callbackCount](const sl::memory::LevelArenaCollision &collision) {
+			++callbackCount;
+			REQUIRE(collision.side == sl::memory::DoubleStackSide::eTop);
+			REQUIRE(collision.requestedSize == 3_kiB);
+		});
+
+		REQUIRE(arena.allocatePersistent(2_kiB, 16) != nullptr);
+		REQUIRE(arena.allocateScratch(3_kiB, 16) == nullptr);
+		REQUIRE(arena.getCollisionCount() == 1);
+		REQUIRE(callbackCount == 1);
+		REQUIRE(arena.getLastCollision().freeSize == 2_kiB);
+
+		std::pmr::vector<std::byte> scratch {&arena.getScratchResource()};
+		REQUIRE_THROWS_AS(scratch.reserve(3_kiB), std::bad_alloc);
+		REQUIRE(arena.getCollisionCount() == 2);
+	}
+}
@@ -0,0 +1,88 @@
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <sl/memory/heapAllocator.hpp>
+#include <sl/memory/pageProvider.hpp>
+#include <sl/memory/stackAllocator.hpp>
+
+
+using namespace sl::utils::literals;
+
+
+TEST_CASE("sl::memory::PageProvider", "[sl::memory::PageProvider]") {
+	SECTION("Every mode gives aligned and writable memory") {
+		for (const auto hugePages : {sl::memory::HugePageMode::eNone, sl::memory::HugePageMode::eTransparent, sl::memory::HugePageMode::eExplicit}) {
+			for (const bool prefault : {false, true}) {
+				const sl::memory::PageProvider pageProvider {sl::memory::PageProviderCreateInfos{.hugePages = hugePages, .prefault = prefault}};
+				const std::size_t granularity {pageProvider.getGranularity()};
+				REQUIRE(granularity != 0);
+
+				std::byte *memory {pageProvider.allocate(3_MiB)};
+				REQUIRE(memory != nullptr);
+				REQUIRE(reinterpret_cast<std::uintptr_t> (memory) % granularity == 0);
+				std::ranges::fill_n(memory, 3_MiB, std::byte{42});
+				REQUIRE(memory[3_MiB - 1] == std::byte{42});
+				pageProvider.deallocate(memory, 3_MiB);
+			}
+		}
+	}
+
+	SECTION("NUMA placement") {
+		const sl::memory::PageProvider pageProvider {sl::memory::PageProviderCreateInfos{.prefault = true, .numaNode = 0}};
+		std::byte *memory {pageProvider.allocate(1_MiB)};
+		REQUIRE(memory != nullptr);
+		memory[0] = std::byte{1};
+		pageProvider.deallocate(memory, 1_MiB);
+	}
+
+	SECTION("Allocators backed by huge pages") {
+		const sl::memory::PageProviderCreateInfos hugePages {.hugePages = sl::memory::HugePageMode::eTransparent};
+
+		sl::memory::HeapAllocator heapAllocator {4_MiB, 2, 32_B, hugePages};
+		auto handle {heapAllocator.allocate(1_MiB, 64)};
+		REQUIRE(handle != nullptr);
+		REQUIRE(reinterpret_cast<std::uintptr_t> (&*handle) % (2_MiB) == 0);
+		heapAllocator.deallocate(handle);
+
+		sl::memory::StackAllocator stackAllocator {sl::memory::StackAllocatorCreateInfos{.size = 4_MiB, .pages = hugePages}};
+		std::byte *ptr {stackAllocator.allocate(64, 8)};
+		REQUIRE(ptr != nullptr);
+		REQUIRE(reinterpret_cast<std::uintptr_t> (ptr) % (2_MiB) == 0);
+	}
+}
+
+
+TEST_CASE("sl::memory::PageProvider : benchmarks", "[sl::memory::PageProvider][.benchmark]") {
+	// far more 4 KiB pages than the TLB holds entries, but few enough 2 MiB pages to fit in it
+	static constexpr std::size_t ARENA_SIZE {512 * 1024 * 1024};
+	static constexpr std::size_t ACCESS_COUNT {1 << 20};
+
+	std::vector<std::size_t> offsets (ACCESS_COUNT);
+	std::mt19937_64 randomEngine {42};
+	std::uniform_int_distribution<std::size_t> offsetDistribution {0, ARENA_SIZE / sizeof(std::uint64_t) - 1};
+	std::ranges::generate(offsets, [&] {return offsetDistribution(randomEngine);});
+
+	const auto sweep = [&offsets](sl::memory::HugePageMode hugePages) {
+		const sl::memory::PageProvider pageProvider {sl::memory::PageProviderCreateInfos{.hugePages = hugePages, .prefault = true}};
+		std::uint64_t *arena {reinterpret_cast<std::uint64_t*> (pageProvider.allocate(ARENA_SIZE))};
+		REQUIRE(arena != nullptr);
+
+		std::uint64_t sum {0};
+		BENCHMARK(hugePages == sl::memory::HugePageMode::eNone ? "1M random reads in 512 MiB of 4 KiB pages" : "1M random reads in 512 MiB of huge pages") {
+			for (const std::size_t offset : offsets)
+				sum += arena[offset];
+			return sum;
+		};
+
+		pageProvider.deallocate(reinterpret_cast<std::byte*> (arena), ARENA_SIZE);
+	};
+
+	sweep(sl::memory::HugePageMode::eNone);
+	sweep(sl::memory::HugePageMode::eTransparent);
+}
@@ -0,0 +1,214 @@
+#include <algorithm>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <sl/memory/poolAllocator.hpp>
+
+
+TEST_CASE("sl::memory::PoolAllocator", "[sl::memory::PoolAllocator]") {
+	sl::memory::PoolAllocator<int> poolAllocator {64};
+
+	SECTION("Allocation and deallocation") {
+		std::vector<int*> pointers {};
+		for (int i {0}; i < 64; ++i) {
+			pointers.push_back(poolAllocator.allocate());
+			REQUIRE(pointers.back() != nullptr);
+			*pointers.back() = i;
+		}
+		REQUIRE(poolAllocator.allocate() == nullptr);
+
+		for (int i {0}; i < 64; ++i)
+			REQUIRE(*pointers[i] == i);
+
+		poolAllocator.deallocate(pointers[10]);
+		poolAllocator.deallocate(pointers[20]);
+		int *first {poolAllocator.allocate()};
+		int *second {poolAllocator.allocate()};
+		REQUIRE(((first == pointers[10] && second == pointers[20]) || (first == pointers[20] && second == pointers[10])));
+		REQUIRE(poolAllocator.allocate() == nullptr);
+	}
+
+	SECTION("Double deallocation is ignored") {
+		int *first {poolAllocator.allocate()};
+		poolAllocator.deallocate(first);
+		poolAllocator.deallocate(first);
+		REQUIRE(poolAllocator.allocate() == first);
+		REQUIRE(poolAllocator.allocate() != first);
+	}
+
+	SECTION("Iteration visits live slots only") {
+		std::vector<int*> pointers {};
+		for (int i {0}; i < 16; ++i) {
+			pointers.push_back(poolAllocator.allocate());
+			*pointers.back() = i;
+		}
+		for (std::size_t i {0}; i < pointers.size(); i += 2)
+			poolAllocator.deallocate(pointers[i]);
+
+		std::vector<int> values {};
+		for (int value : poolAllocator)
+			values.push_back(value);
+		REQUIRE(values == std::vector<int> {1, 3, 5, 7, 9, 11, 13, 15});
+	}
+
+	SECTION("Iteration in both directions across words") {
+		sl::memory::PoolAllocator<int> sparseAllocator {200};
+		std::vector<int*> pointers {};
+		for (int i {0}; i < 200; ++i) {
+			pointers.push_back(sparseAllocator.allocate());
+			*pointers.back() = i;
+		}
+		for (int i {0}; i < 200; ++i) {
+			if (i != 3 && i != 64 && i != 130 && i != 199)
+				sparseAllocator.deallocate(pointers[i]);
+		}
+
+		std::vector<int> values {sparseAllocator.begin(), sparseAllocator.end()};
+		REQUIRE(values == std::vector<int> {3, 64, 130, 199});
+
+		values.clear();
+		for (auto it {sparseAllocator.end()}; it != sparseAllocator.begin();)
+			values.push_back(*--it);
+		REQUIRE(values == std::vector<int> {199, 130, 64, 3});
+
+		sl::memory::PoolAllocator<int> emptyAllocator {100};
+		REQUIRE(emptyAllocator.begin() == emptyAllocator.end());
+	}
+
+	SECTION("Copies share their free list") {
+		sl::memory::PoolAllocator<int> copy {poolAllocator};
+		int *first {poolAllocator.allocate()};
+		copy.deallocate(first);
+		REQUIRE(poolAllocator.allocate() == first);
+		REQUIRE(copy.allocate() != first);
+	}
+
+	SECTION("Copies can be made and dropped on several threads") {
+		(void)poolAllocator.allocate();
+		std::vector<std::thread> threads {};
+		for (std::size_t i {0}; i < 4; ++i) {
+			// the last thread to drop its copy frees the pool
+			threads.emplace_back([copy = poolAllocator] {
+				for (std::size_t j {0}; j < 10'000; ++j)
+					[[maybe_unused]] const sl::memory::PoolAllocator<int> other {copy};
+			});
+		}
+
+		poolAllocator = sl::memory::PoolAllocator<int> {8};
+		for (auto &thread : threads)
+			thread.join();
+		REQUIRE(poolAllocator.allocate() != nullptr);
+	}
+
+	SECTION("Growable pool adds chunks without moving slots") {
+		sl::memory::PoolAllocator<int> growableAllocator {16, sl::memory::PoolAllocator<int>::UNLIMITED_CHUNK_COUNT};
+		std::vector<int*> pointers {};
+		for (int i {0}; i < 1000; ++i) {
+			pointers.push_back(growableAllocator.allocate());
+			REQUIRE(pointers.back() != nullptr);
+			*pointers.back() = i;
+		}
+		for (int i {0}; i < 1000; ++i)
+			REQUIRE(*pointers[i] == i);
+
+		for (std::size_t i {0}; i < pointers.size(); ++i) {
+			if (i % 100 != 0)
+				growableAllocator.deallocate(pointers[i]);
+		}
+		std::vector<int> values {growableAllocator.begin(), growableAllocator.end()};
+		REQUIRE(values == std::vector<int> {0, 100, 200, 300, 400, 500, 600, 700, 800, 900});
+
+		int *reused {growableAllocator.allocate()};
+		REQUIRE(std::ranges::find(pointers, reused) != pointers.end());
+	}
+
+	SECTION("Capped growable pool") {
+		sl::memory::PoolAllocator<int> cappedAllocator {4, 2};
+		for (int i {0}; i < 8; ++i)
+			REQUIRE(cappedAllocator.allocate() != nullptr);
+		REQUIRE(cappedAllocator.allocate() == nullptr);
+	}
+
+	SECTION("Chunk size is the exact capacity of each chunk") {
+		sl::memory::PoolAllocator<int> oddAllocator {100, 2};
+		std::vector<int*> pointers {};
+		for (int i {0}; i < 200; ++i) {
+			pointers.push_back(oddAllocator.allocate());
+			REQUIRE(pointers.back() != nullptr);
+			*pointers.back() = i;
+		}
+		REQUIRE(oddAllocator.allocate() == nullptr);
+
+		std::vector<int> values {oddAllocator.begin(), oddAllocator.end()};
+		REQUIRE(values.size() == 200);
+		REQUIRE(std::ranges::is_sorted(values));
+		oddAllocator.deallocate(pointers[150]);
+		REQUIRE(oddAllocator.allocate() == pointers[150]);
+	}
+
+	SECTION("Move assignment releases the previous pool") {
+		sl::memory::PoolAllocator<int> other {16};
+		int *value {other.allocate()};
+		*value = 42;
+		(void)poolAllocator.allocate();
+
+		poolAllocator = std::move(other);
+		REQUIRE(*poolAllocator.begin() == 42);
+		poolAllocator.deallocate(value);
+		REQUIRE(poolAllocator.allocate() == value);
+
+		sl::memory::PoolAllocator<int> copy {poolAllocator};
+		copy = poolAllocator;
+		poolAllocator = sl::memory::PoolAllocator<int> {8};
+		REQUIRE(copy.allocate() != nullptr);
+	}
+}
+
+
+TEST_CASE("sl::memory::PoolAllocator : benchmarks", "[sl::memory::PoolAllocator][.benchmark]") {
+	constexpr std::size_t POOL_SIZE {1'000'000};
+
+	for (std::size_t occupancy : {10, 50, 99}) {
+		sl::memory::PoolAllocator<std::uint64_t> poolAllocator {POOL_SIZE};
+		std::mt19937_64 randomEngine {42};
+		std::vector<std::uint64_t*> pointers {};
+
+		pointers.reserve(POOL_SIZE);
+		for (std::size_t i {0}; i < POOL_SIZE; ++i)
+			pointers.push_back(poolAllocator.allocate());
+		std::ranges::shuffle(pointers, randomEngine);
+		for (std::size_t i {POOL_SIZE * occupancy / 100}; i < POOL_SIZE; ++i)
+			poolAllocator.deallocate(pointers[i]);
+
+		BENCHMARK("Allocate and deallocate at " + std::to_string(occupancy) + "% occupancy") {
+			std::uint64_t *pointer {poolAllocator.allocate()};
+			poolAllocator.deallocate(pointer);
+			return pointer;
+		};
+	}
+
+
+	BENCHMARK_ADVANCED("Iterate a 1M slots pool with 1% live slots")(Catch::Benchmark::Chronometer meter) {
+		sl::memory::PoolAllocator<std::uint64_t> poolAllocator {POOL_SIZE};
+		std::mt19937_64 randomEngine {42};
+		std::vector<std::uint64_t*> pointers {};
+
+		pointers.reserve(POOL_SIZE);
+		for (std::size_t i {0}; i < POOL_SIZE; ++i)
+			pointers.push_back(poolAllocator.allocate());
+		std::ranges::shuffle(pointers, randomEngine);
+		for (std::size_t i {POOL_SIZE / 100}; i < POOL_SIZE; ++i)
+			poolAllocator.deallocate(pointers[i]);
+
+		meter.measure([&poolAllocator] {
+			std::size_t count {0};
+			for (auto it {poolAllocator.begin()}; it != poolAllocator.end(); ++it)
+				++count;
+			return count;
+		});
+	};
+}
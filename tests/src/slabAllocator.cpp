@@ -0,0 +1,142 @@
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <sl/memory/slabAllocator.hpp>
+
+
+using namespace sl::utils::literals;
+
+
+TEST_CASE("sl::memory::SlabAllocator", "[sl::memory::SlabAllocator]") {
+	sl::memory::SlabAllocator slabAllocator {};
+
+	SECTION("Size classes") {
+		REQUIRE(sl::memory::SlabAllocator::getBlockSize(1) == 16);
+		REQUIRE(sl::memory::SlabAllocator::getBlockSize(17, 8) == 24);
+		REQUIRE(sl::memory::SlabAllocator::getBlockSize(17, 16) == 32);
+		REQUIRE(sl::memory::SlabAllocator::getBlockSize(65, 8) == 80);
+		REQUIRE(sl::memory::SlabAllocator::getBlockSize(200, 8) == 224);
+		REQUIRE(sl::memory::SlabAllocator::getBlockSize(256, 8) == 256);
+		REQUIRE(sl::memory::SlabAllocator::getBlockSize(257, 8) == 0);
+		REQUIRE(sl::memory::SlabAllocator::getBlockSize(64, 512) == 0);
+
+		for (std::size_t size {1}; size <= sl::memory::SlabAllocator::MAX_SIZE_CLASS; ++size) {
+			const std::size_t blockSize {sl::memory::SlabAllocator::getBlockSize(size, 8)};
+			REQUIRE(blockSize >= size);
+			REQUIRE(blockSize <= std::max<std::size_t> (16, size + size / 2));
+		}
+	}
+
+	SECTION("Allocation, alignment and reuse") {
+		std::vector<std::tuple<std::byte*, std::size_t, std::size_t>> blocks {};
+		for (std::size_t size {1}; size <= 300; ++size) {
+			for (const std::size_t alignment : {1, 8, 16}) {
+				std::byte *ptr {slabAllocator.allocate(size, alignment)};
+				REQUIRE(ptr != nullptr);
+				REQUIRE(reinterpret_cast<std::uintptr_t> (ptr) % alignment == 0);
+				std::ranges::fill_n(ptr, size, static_cast<std::byte> (size));
+				blocks.emplace_back(ptr, size, alignment);
+			}
+		}
+
+		for (const auto &[ptr, size, alignment] : blocks)
+			REQUIRE(std::ranges::all_of(ptr, ptr + size, [size](std::byte value) {return value == static_cast<std::byte> (size);}));
+
+		std::byte *ptr {slabAllocator.allocate(40, 8)};
+		slabAllocator.deallocate(ptr, 40, 8);
+		REQUIRE(slabAllocator.allocate(33, 8) == ptr);
+
+		// the sizes past the largest size class live in the upstream resource, which the slabs don't release
+		for (const auto &[block, size, alignment] : blocks)
+			slabAllocator.deallocate(block, size, alignment);
+	}
+
+	SECTION("Upstream failure returns nullptr") {
+		sl::memory::SlabAllocator failingAllocator {sl::memory::SlabAllocatorCreateInfos{.upstream = std::pmr::null_memory_resource()}};
+		REQUIRE(failingAllocator.allocate(512, 8) == nullptr);
+		REQUIRE(failingAllocator.allocate(64, 8) != nullptr);
+	}
+
+	SECTION("View and memory resource") {
+		std::vector<int, sl::memory::SlabAllocatorView<int>> values {sl::memory::SlabAllocatorView<int> (slabAllocator)};
+		for (int i {0}; i < 1000; ++i)
+			values.push_back(i);
+		for (int i {0}; i < 1000; ++i)
+			REQUIRE(values[i] == i);
+
+		sl::memory::SlabMemoryResource slabMemoryResource {slabAllocator};
+		std::pmr::vector<std::pmr::string> strings {&slabMemoryResource};
+		for (int i {0}; i < 100; ++i)
+			strings.emplace_back(static_cast<std::size_t> (i), 'a');
+		for (int i {0}; i < 100; ++i)
+			REQUIRE(std::string_view(strings[i]) == std::string(static_cast<std::size_t> (i), 'a'));
+	}
+	SECTION("Move assignment releases the previous slabs") {
+		(void)slabAllocator.allocate(16, 8);
+		sl::memory::SlabAllocator other {};
+		std::byte *ptr {other.allocate(64, 8)};
+		std::ranges::fill_n(ptr, 64, std::byte{42});
+
+		slabAllocator = std::move(other);
+		REQUIRE(slabAllocator.getSlabCount() == 1);
+		REQUIRE(other.getSlabCount() == 0);
+		REQUIRE(ptr[63] == std::byte{42});
+		slabAllocator.deallocate(ptr, 64, 8);
+		REQUIRE(slabAllocator.allocate(64, 8) == ptr);
+	}
+}
+
+
+TEST_CASE("sl::memory::SlabAllocator : benchmarks", "[sl::memory::SlabAllocator][.benchmark]") {
+	static constexpr std::size_t LIVE_COUNT {4096};
+	static constexpr std::size_t OPERATION_COUNT {100'000};
+
+	std::mt19937_64 randomEngine {42};
+	std::uniform_int_distribution<std::size_t> sizeDistribution {16, 256};
+	std::vector<std::size_t> sizes (OPERATION_COUNT);
+	std::vector<std::size_t> slots (OPERATION_COUNT);
+	std::ranges::generate(sizes, [&] {return sizeDistribution(randomEngine);});
+	std::ranges::generate(slots, [&] {return randomEngine() % LIVE_COUNT;});
+
+	BENCHMARK_ADVANCED("Mixed sizes 16-256 B with malloc")(Catch::Benchmark::Chronometer meter) {
+		std::vector<std::pair<void*, std::size_t>> live (LIVE_COUNT);
+		for (std::size_t i {0}; i < LIVE_COUNT; ++i)
+			live[i] = {std::malloc(sizes[i]), sizes[i]};
+
+		meter.measure([&] {
+			for (std::size_t i {0}; i < OPERATION_COUNT; ++i) {
+				auto &block {live[slots[i]]};
+				std::free(block.first);
+				block = {std::malloc(sizes[i]), sizes[i]};
+			}
+			return live[0].first;
+		});
+
+		for (const auto &block : live)
+			std::free(block.first);
+	};
+
+	BENCHMARK_ADVANCED("Mixed sizes 16-256 B with SlabAllocator")(Catch::Benchmark::Chronometer meter) {
+		sl::memory::SlabAllocator slabAllocator {};
+		std::vector<std::pair<std::byte*, std::size_t>> live (LIVE_COUNT);
+		for (std::size_t i {0}; i < LIVE_COUNT; ++i)
+			live[i] = {slabAllocator.allocate(sizes[i], 8), sizes[i]};
+
+		meter.measure([&] {
+			for (std::size_t i {0}; i < OPERATION_COUNT; ++i) {
+				auto &block {live[slots[i]]};
+				slabAllocator.deallocate(block.first, block.second, 8);
+				block = {slabAllocator.allocate(sizes[i], 8), sizes[i]};
+			}
+			return live[0].first;
+		});
+	};
+}
@@ -0,0 +1,70 @@
+#include <algorithm>
+#include <cstdint>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <sl/memory/stackAllocator.hpp>
+
+
+using namespace sl::utils::literals;
+
+
+TEST_CASE("sl::memory::StackAllocator", "[sl::memory::StackAllocator]") {
+	SECTION("Allocation, marker and overflow") {
+		sl::memory::StackAllocator stackAllocator {1_kiB};
+		std::byte *first {stackAllocator.allocate(100, 1)};
+		REQUIRE(first != nullptr);
+		auto marker {stackAllocator.mark()};
+		std::byte *second {stackAllocator.allocate(16, 16)};
+		REQUIRE(reinterpret_cast<std::uintptr_t> (second) % 16 == 0);
+		REQUIRE(second >= first + 100);
+
+		stackAllocator.deallocate(marker);
+		REQUIRE(stackAllocator.allocate(16, 16) == second);
+		REQUIRE(stackAllocator.allocate(2_kiB, 1) == nullptr);
+	}
+
+	SECTION("Virtual stack commits memory as it grows") {
+		sl::memory::StackAllocator stackAllocator {sl::memory::StackAllocatorCreateInfos{
+			.size = 1_GiB,
+			.isVirtual = true,
+			.highWaterMark = 1_MiB
+		}};
+		REQUIRE(stackAllocator.getCommittedSize() == 0_B);
+
+		std::byte *first {stackAllocator.allocate(100, 8)};
+		REQUIRE(first != nullptr);
+		REQUIRE(stackAllocator.getCommittedSize() >= 100_B);
+		REQUIRE(stackAllocator.getCommittedSize() < 1_MiB);
+
+		std::byte *second {stackAllocator.allocate(8_MiB, 8)};
+		REQUIRE(second != nullptr);
+		std::ranges::fill_n(second, 8_MiB, std::byte{42});
+		REQUIRE(stackAllocator.getCommittedSize() >= 8_MiB);
+
+		stackAllocator.clear();
+		REQUIRE(stackAllocator.getCommittedSize() <= 1_MiB + 1_MiB);
+		REQUIRE(stackAllocator.getCommittedSize() >= 1_MiB);
+		REQUIRE(stackAllocator.allocate(4_MiB, 8) == first);
+	}
+
+	SECTION("Virtual stack still has a hard limit") {
+		sl::memory::StackAllocator stackAllocator {sl::memory::StackAllocatorCreateInfos{.size = 1_MiB, .isVirtual = true}};
+		REQUIRE(stackAllocator.allocate(512_kiB, 1) != nullptr);
+		REQUIRE(stackAllocator.allocate(1_MiB, 1) == nullptr);
+		REQUIRE(stackAllocator.allocate(512_kiB, 1) != nullptr);
+	}
+
+	SECTION("Move assignment releases the previous stack") {
+		sl::memory::StackAllocator stackAllocator {1_kiB};
+		REQUIRE(stackAllocator.allocate(100, 1) != nullptr);
+		sl::memory::StackAllocator other {sl::memory::StackAllocatorCreateInfos{.size = 1_MiB, .isVirtual = true}};
+		std::byte *first {other.allocate(100, 1)};
+		REQUIRE(first != nullptr);
+
+		stackAllocator = std::move(other);
+		REQUIRE(stackAllocator.owns(first));
+		REQUIRE(stackAllocator.allocate(512_kiB, 1) != nullptr);
+		REQUIRE(other.allocate(1, 1) == nullptr);
+	}
+}
@@ -1,8 +1,18 @@
+#include <algorithm>
+#include <bit>
+#include <charconv>
+#include <cmath>
+#include <limits>
+#include <random>
 #include <ranges>
 #include <string>
+#include <string_view>
+#include <vector>
 
 #include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
 
+#include <sl/utils/hash.hpp>
 #include <sl/utils/string.hpp>
 
 
@@ -187,3 +197,501 @@ TEST_CASE("sl::String : Heap", "[sl::String]") {
 
 	#undef STR_LITERAL
 }
+
+
+TEST_CASE("sl::String : Growth", "[sl::String]") {
+	sl::String str {};
+
+	SECTION("Amortized appending") {
+		std::size_t reallocationCount {0};
+		std::size_t capacity {str.getCapacity()};
+		for (std::size_t i {0}; i < 4096; ++i) {
+			str += "abcd";
+			if (str.getCapacity() != capacity) {
+				REQUIRE(str.getCapacity() >= capacity * 3 / 2);
+				capacity = str.getCapacity();
+				++reallocationCount;
+			}
+		}
+		REQUIRE(str.getSize() == 4 * 4096);
+		REQUIRE(reallocationCount < 32);
+		REQUIRE(str.getData()[str.getSize()] == '\0');
+		for (std::size_t i {0}; i < str.getSize(); ++i)
+			REQUIRE(str[i] == "abcd"[i % 4]);
+	}
+
+	SECTION("Appending and inserting a string into itself") {
+		str = "Hello World !";
+		str += str;
+		REQUIRE(str == "Hello World !Hello World !");
+		str.pushBack(str.getData() + 6);
+		REQUIRE(str == "Hello World !Hello World !World !Hello World !");
+		str = "Hello World !";
+		str.insert(6, str);
+		REQUIRE(str == "Hello Hello World !World !");
+	}
+}
+
+
+TEST_CASE("sl::String : Copy and move", "[sl::String]") {
+	// one SSO and one heap string
+	for (const char *literal : {"Hello World !", "Hello World from Steelux !"}) {
+		sl::String str {literal};
+
+		sl::String copy {str};
+		REQUIRE(copy == literal);
+		copy = copy;
+		REQUIRE(copy == literal);
+		sl::String other {"Something else entirely, on the heap"};
+		other = str;
+		REQUIRE(other == literal);
+		REQUIRE(str == literal);
+
+		sl::String moved {std::move(str)};
+		REQUIRE(moved == literal);
+		REQUIRE(str.isEmpty());
+		REQUIRE(str.getData()[0] == '\0');
+		str += "reused";
+		REQUIRE(str == "reused");
+
+		other = std::move(moved);
+		REQUIRE(other == literal);
+		REQUIRE(moved.isEmpty());
+		REQUIRE(moved.getData()[0] == '\0');
+	}
+}
+
+
+template <typename String>
+static auto isInline(const String &str) noexcept -> bool {
+	const auto *object {reinterpret_cast<const char*> (&str)};
+	const auto *data {reinterpret_cast<const char*> (str.getData())};
+	return data >= object && data < object + sizeof(String);
+}
+
+
+TEST_CASE("sl::String : SSO capacity", "[sl::String]") {
+	using String48 = sl::utils::BasicString<char, sl::memory::DefaultAllocator<char>, 48>;
+
+	static_assert(sizeof(sl::String) == 24);
+	static_assert(sizeof(String48) == 56);
+	static_assert(sizeof(sl::utils::BasicString<char, sl::memory::DefaultAllocator<char>, 8>) == sizeof(sl::String));
+	static_assert(sizeof(sl::InlineString<32>) == 40);
+	static_assert(std::ranges::random_access_range<sl::InlineString<32>>);
+
+	SECTION("Custom SSO capacity") {
+		String48 str {"This string has 47 characters and stays inline."};
+		REQUIRE(str.getSize() == 47);
+		REQUIRE(str.getCapacity() == 48);
+		REQUIRE(isInline(str));
+
+		str.pushBack('!');
+		REQUIRE(str == "This string has 47 characters and stays inline.!");
+		REQUIRE(!isInline(str));
+		REQUIRE(str.getCapacity() >= 49);
+		str.popBack(10);
+		str.shrinkToFit();
+		REQUIRE(isInline(str));
+		REQUIRE(str.getCapacity() == 48);
+
+		// capacities below the size of the heap representation are rounded up
+		const sl::utils::BasicString<char, sl::memory::DefaultAllocator<char>, 8> small {"fifteen chars !"};
+		REQUIRE(small.getCapacity() == 16);
+		REQUIRE(isInline(small));
+	}
+
+	SECTION("Inline string never allocates") {
+		sl::InlineString<16> str {"Hello World !"};
+		REQUIRE(str.getCapacity() == 16);
+		REQUIRE(str.reserve(100) == 15);
+		REQUIRE(str.getCapacity() == 16);
+
+		str.pushBack(" Steelux");
+		REQUIRE(str == "Hello World ! S");
+		REQUIRE(str.getSize() == 15);
+		REQUIRE(isInline(str));
+		str.pushBack('x', 4);
+		REQUIRE(str == "Hello World ! S");
+
+		str.erase(5, 8);
+		REQUIRE(str == "Hello S");
+		str.insert(5, " World, and more than fits");
+		REQUIRE(str == "Hello World,  S");
+		str.pushFront(std::views::iota(0, 4) | std::views::transform([](auto val) -> char {return 'A' + val;}));
+		REQUIRE(str == "Hello World,  S");
+		str.popBack(4);
+		str.pushFront(std::views::iota(0, 8) | std::views::transform([](auto val) -> char {return 'A' + val;}));
+		REQUIRE(str == "ABCDHello World");
+
+		const sl::InlineString<16> truncated {"This literal is too long"};
+		REQUIRE(truncated == "This literal is");
+		const sl::InlineString<16> truncatedSpan {"This literal is too long", 20};
+		REQUIRE(truncatedSpan == "This literal is");
+	}
+
+	SECTION("Interoperability") {
+		sl::InlineString<32> str {"Hello"};
+		const sl::String heap {" World from Steelux !"};
+		str += heap;
+		REQUIRE(str == "Hello World from Steelux !");
+		REQUIRE(str == sl::String{"Hello World from Steelux !"});
+		REQUIRE(sl::String{"Hello World from Steelux !"} == str);
+		REQUIRE(str.find(sl::String{"World"}) == 6);
+		REQUIRE(sl::utils::hash<sl::utils::Hash64> (str) == sl::utils::hash<sl::utils::Hash64> (sl::String{"Hello World from Steelux !"}));
+
+		const sl::InlineString<32> copy {str};
+		sl::InlineString<32> moved {std::move(str)};
+		REQUIRE(moved == copy);
+		REQUIRE(str.isEmpty());
+
+		const sl::InlineString<32> concatenated {copy + " Hi"};
+		REQUIRE(concatenated == "Hello World from Steelux ! Hi");
+		REQUIRE(sl::utils::stringToNumber<std::int32_t> (sl::InlineString<8> {"1234"}) == 1234);
+	}
+}
+
+
+TEST_CASE("sl::String : Search and comparison", "[sl::String]") {
+	const sl::String str {"Hello World from Steelux ! Hello again"};
+
+	SECTION("Find") {
+		REQUIRE(str.find('o') == 4);
+		REQUIRE(str.find('o', 5) == 7);
+		REQUIRE(str.find('z') == std::nullopt);
+		REQUIRE(str.rfind('o') == 31);
+		REQUIRE(str.find("Hello") == 0);
+		REQUIRE(str.find("Hello", 1) == 27);
+		REQUIRE(str.rfind("Hello") == 27);
+		REQUIRE(str.find(sl::String{"Steelux"}) == 17);
+		REQUIRE(str.find("Steelix") == std::nullopt);
+		REQUIRE(str.find("") == 0);
+		REQUIRE(str.contains("from"));
+		REQUIRE(!str.contains("to"));
+		REQUIRE(str.startsWith("Hello World"));
+		REQUIRE(!str.startsWith("World"));
+		REQUIRE(str.endsWith("again"));
+		REQUIRE(!str.endsWith("Hello"));
+	}
+
+	SECTION("Comparison") {
+		REQUIRE(str.compare(str) == std::strong_ordering::equal);
+		REQUIRE(sl::String{"abc"} < sl::String{"abd"});
+		REQUIRE(sl::String{"abc"} < sl::String{"abcd"});
+		REQUIRE(sl::String{"b"} > "abcd");
+		REQUIRE(sl::String{"\xff"} > "a");
+		REQUIRE(sl::String{"Hello"} != "Hello World");
+	}
+
+	SECTION("Against std::string_view") {
+		std::mt19937 rng {42};
+		for (std::size_t i {0}; i < 2000; ++i) {
+			// small alphabet so that the first and last characters often match without the whole pattern matching
+			sl::String haystack {};
+			const std::size_t size {rng() % 200};
+			for (std::size_t j {0}; j < size; ++j)
+				haystack.pushBack(static_cast<char> ('a' + rng() % 3));
+			sl::String pattern {};
+			const std::size_t patternSize {1 + rng() % 6};
+			for (std::size_t j {0}; j < patternSize; ++j)
+				pattern.pushBack(static_cast<char> ('a' + rng() % 3));
+
+			const std::string_view haystackView {haystack.getData(), haystack.getSize()};
+			const std::string_view patternView {pattern.getData(), pattern.getSize()};
+			const auto toOptional = [](std::size_t position) -> std::optional<std::size_t> {
+				return position == std::string_view::npos ? std::nullopt : std::optional<std::size_t> (position);
+			};
+			REQUIRE(haystack.find(pattern) == toOptional(haystackView.find(patternView)));
+			REQUIRE(haystack.rfind(pattern) == toOptional(haystackView.rfind(patternView)));
+			REQUIRE(haystack.find(pattern[0]) == toOptional(haystackView.find(patternView[0])));
+			REQUIRE(haystack.rfind(pattern[0]) == toOptional(haystackView.rfind(patternView[0])));
+			REQUIRE((haystack <=> pattern) == (haystackView <=> patternView));
+		}
+	}
+
+	SECTION("Compile time") {
+		static constexpr char TEXT[] {"Hello World, Hello"};
+		static_assert(sl::utils::find(TEXT, 18, "World", 5) == TEXT + 6);
+		static_assert(sl::utils::findLast(TEXT, 18, "Hello", 5) == TEXT + 13);
+		static_assert(sl::utils::findChar(TEXT, 18, 'l') == TEXT + 2);
+		static_assert(sl::utils::findLastChar(TEXT, 18, 'W') == TEXT + 6);
+		static_assert(sl::utils::compare("abc", "abd", 3) < 0);
+	}
+}
+
+
+TEST_CASE("sl::String : Number parsing", "[sl::String]") {
+	SECTION("Integers") {
+		REQUIRE(sl::utils::stringToNumber<std::int32_t> (sl::String{"42"}) == 42);
+		REQUIRE(sl::utils::stringToNumber<std::int32_t> (sl::String{"-42"}) == -42);
+		REQUIRE(sl::utils::stringToNumber<std::int32_t> (sl::String{"+42"}) == 42);
+		REQUIRE(sl::utils::stringToNumber<std::int32_t> (sl::String{"0"}) == 0);
+		REQUIRE(sl::utils::stringToNumber<std::uint32_t> (sl::String{"0x1fF"}) == 0x1ff);
+		REQUIRE(sl::utils::stringToNumber<std::uint32_t> (sl::String{"0b1011"}) == 0b1011);
+		REQUIRE(sl::utils::stringToNumber<std::uint32_t> (sl::String{"0o17"}) == 017);
+		REQUIRE(sl::utils::stringToNumber<std::uint64_t> (sl::String{"18446744073709551615"}) == 18446744073709551615ull);
+		REQUIRE(sl::utils::stringToNumber<std::int64_t> (sl::String{"-9223372036854775808"}) == std::numeric_limits<std::int64_t>::min());
+		REQUIRE(sl::utils::stringToNumber<std::int8_t> (sl::String{"-128"}) == -128);
+		REQUIRE(sl::utils::stringToNumber<std::int32_t> (L"-0x7fffffff", 11) == -0x7fffffff);
+
+		REQUIRE(!sl::utils::stringToNumber<std::int32_t> (sl::String{""}));
+		REQUIRE(!sl::utils::stringToNumber<std::int32_t> (sl::String{"-"}));
+		REQUIRE(!sl::utils::stringToNumber<std::int32_t> (sl::String{"0x"}));
+		REQUIRE(!sl::utils::stringToNumber<std::int32_t> (sl::String{"12a"}));
+		REQUIRE(!sl::utils::stringToNumber<std::int32_t> (sl::String{"1234567890123"}));
+		REQUIRE(!sl::utils::stringToNumber<std::uint32_t> (sl::String{"-1"}));
+		REQUIRE(!sl::utils::stringToNumber<std::int8_t> (sl::String{"128"}));
+		REQUIRE(!sl::utils::stringToNumber<std::uint64_t> (sl::String{"18446744073709551616"}));
+		REQUIRE(!sl::utils::stringToNumber<std::uint32_t> (sl::String{"0b102"}));
+
+		std::mt19937_64 rng {42};
+		for (std::size_t i {0}; i < 10'000; ++i) {
+			const auto value {static_cast<std::int64_t> (rng()) >> (rng() % 64)};
+			const std::string text {std::to_string(value)};
+			REQUIRE(sl::utils::stringToNumber<std::int64_t> (text.data(), text.size()) == value);
+		}
+	}
+
+	SECTION("Floating points") {
+		REQUIRE(sl::utils::stringToNumber<double> (sl::String{"1.5"}) == 1.5);
+		REQUIRE(sl::utils::stringToNumber<double> (sl::String{"-0.25e2"}) == -25.0);
+		REQUIRE(sl::utils::stringToNumber<double> (sl::String{"+.5"}) == 0.5);
+		REQUIRE(sl::utils::stringToNumber<double> (sl::String{"5."}) == 5.0);
+		REQUIRE(sl::utils::stringToNumber<double> (sl::String{"1E-3"}) == 1e-3);
+		REQUIRE(sl::utils::stringToNumber<double> (sl::String{"0.1"}) == 0.1);
+		REQUIRE(sl::utils::stringToNumber<float> (sl::String{"0.1"}) == 0.1f);
+		REQUIRE(sl::utils::stringToNumber<double> (sl::String{"123456789012345678901234567890"}) == 123456789012345678901234567890.0);
+		REQUIRE(sl::utils::stringToNumber<double> (sl::String{"2.2250738585072014e-308"}) == 2.2250738585072014e-308);
+		REQUIRE(std::signbit(*sl::utils::stringToNumber<double> (sl::String{"-0.0"})));
+		REQUIRE(sl::utils::stringToNumber<double> (L"0.30000000000000004", 19) == 0.30000000000000004);
+		REQUIRE(sl::utils::stringToNumber<double> (u"1.25e-2", 7) == 1.25e-2);
+
+		REQUIRE(!sl::utils::stringToNumber<double> (sl::String{""}));
+		REQUIRE(!sl::utils::stringToNumber<double> (sl::String{"."}));
+		REQUIRE(!sl::utils::stringToNumber<double> (sl::String{"1.2.3"}));
+		REQUIRE(!sl::utils::stringToNumber<double> (sl::String{"1e"}));
+		REQUIRE(!sl::utils::stringToNumber<double> (sl::String{"1e+"}));
+		REQUIRE(!sl::utils::stringToNumber<double> (sl::String{"1.5f"}));
+		REQUIRE(!sl::utils::stringToNumber<double> (sl::String{"1e400"}));
+
+		// the shortest representation of a double must parse back to the exact same double
+		std::mt19937_64 rng {42};
+		char buffer[64] {};
+		for (std::size_t i {0}; i < 100'000; ++i) {
+			double value {std::bit_cast<double> (rng())};
+			if (!std::isfinite(value))
+				continue;
+			if (i % 2 == 0)
+				value = static_cast<double> (rng() % 1'000'000) / 1000.0;
+			const char *end {std::to_chars(buffer, buffer + sizeof(buffer), value).ptr};
+			REQUIRE(sl::utils::stringToNumber<double> (buffer, static_cast<std::size_t> (end - buffer)) == value);
+
+			const float floatValue {static_cast<float> (value)};
+			if (!std::isfinite(floatValue))
+				continue;
+			end = std::to_chars(buffer, buffer + sizeof(buffer), floatValue).ptr;
+			REQUIRE(sl::utils::stringToNumber<float> (buffer, static_cast<std::size_t> (end - buffer)) == floatValue);
+		}
+	}
+
+	SECTION("Compile time") {
+		static_assert(sl::utils::stringToNumber<std::int32_t> ("-123456789", 10) == -123456789);
+		static_assert(sl::utils::stringToNumber<std::uint32_t> ("0x1f", 4) == 31);
+		static_assert(sl::utils::stringToNumber<double> ("3.14159", 7) == 3.14159);
+		static_assert(sl::utils::stringToNumber<float> ("-2.5e3", 6) == -2500.0f);
+		static_assert(!sl::utils::stringToNumber<std::int32_t> ("12 ", 3));
+	}
+}
+
+
+TEST_CASE("sl::String : number parsing benchmarks", "[sl::String][.benchmark]") {
+	static constexpr std::size_t NUMBER_COUNT {10'000'000};
+	std::mt19937_64 rng {42};
+	std::string integers {};
+	std::string doubles {};
+	std::vector<std::uint32_t> integerEnds {};
+	std::vector<std::uint32_t> doubleEnds {};
+	integerEnds.reserve(NUMBER_COUNT);
+	doubleEnds.reserve(NUMBER_COUNT);
+	char buffer[64] {};
+	for (std::size_t i {0}; i < NUMBER_COUNT; ++i) {
+		const auto integer {static_cast<std::int64_t> (rng() >> (rng() % 64))};
+		integers.append(buffer, std::to_chars(buffer, buffer + sizeof(buffer), integer).ptr);
+		integerEnds.push_back(static_cast<std::uint32_t> (integers.size()));
+
+		// mixes the config-like numbers with full precision ones
+		const double value {i % 4 == 0 ? static_cast<double> (rng()) / static_cast<double> (rng()) : static_cast<double> (rng() % 100'000) / 100.0};
+		doubles.append(buffer, std::to_chars(buffer, buffer + sizeof(buffer), value).ptr);
+		doubleEnds.push_back(static_cast<std::uint32_t> (doubles.size()));
+	}
+
+	BENCHMARK("Parse 10M integers with sl::utils::stringToNumber") {
+		std::int64_t sum {0};
+		std::uint32_t begin {0};
+		for (const std::uint32_t end : integerEnds) {
+			sum += *sl::utils::stringToNumber<std::int64_t> (integers.data() + begin, end - begin);
+			begin = end;
+		}
+		return sum;
+	};
+
+	BENCHMARK("Parse 10M integers with std::from_chars") {
+		std::int64_t sum {0};
+		std::uint32_t begin {0};
+		for (const std::uint32_t end : integerEnds) {
+			std::int64_t value {};
+			std::from_chars(integers.data() + begin, integers.data() + end, value);
+			sum += value;
+			begin = end;
+		}
+		return sum;
+	};
+
+	BENCHMARK("Parse 10M doubles with sl::utils::stringToNumber") {
+		double sum {0};
+		std::uint32_t begin {0};
+		for (const std::uint32_t end : doubleEnds) {
+			sum += *sl::utils::stringToNumber<double> (doubles.data() + begin, end - begin);
+			begin = end;
+		}
+		return sum;
+	};
+
+	BENCHMARK("Parse 10M doubles with std::from_chars") {
+		double sum {0};
+		std::uint32_t begin {0};
+		for (const std::uint32_t end : doubleEnds) {
+			double value {};
+			std::from_chars(doubles.data() + begin, doubles.data() + end, value);
+			sum += value;
+			begin = end;
+		}
+		return sum;
+	};
+}
+
+
+TEST_CASE("sl::String : benchmarks", "[sl::String][.benchmark]") {
+	static constexpr std::size_t TARGET_SIZE {1024 * 1024};
+	const sl::String piece {"0123456789abcdef"};
+
+	BENCHMARK("Build a 1 MB string from 16 bytes pieces with sl::String") {
+		sl::String str {};
+		while (str.getSize() < TARGET_SIZE)
+			str += piece;
+		return str.getSize();
+	};
+
+	BENCHMARK("Build a 1 MB string from 16 bytes pieces with std::string") {
+		std::string str {};
+		while (str.size() < TARGET_SIZE)
+			str += piece.getData();
+		return str.size();
+	};
+
+	BENCHMARK("Build a 1 MB string from single characters with sl::String") {
+		sl::String str {};
+		for (std::size_t i {0}; i < TARGET_SIZE; ++i)
+			str.pushBack('a');
+		return str.getSize();
+	};
+
+	sl::String haystack {};
+	for (std::size_t i {0}; i < TARGET_SIZE; ++i)
+		haystack.pushBack(static_cast<char> ('a' + i % 23));
+	haystack += "needle";
+	const std::string_view haystackView {haystack.getData(), haystack.getSize()};
+
+	BENCHMARK("Find a substring in 1 MB with sl::String") {
+		return haystack.find("needle");
+	};
+
+	BENCHMARK("Find a substring in 1 MB with std::string_view") {
+		return haystackView.find("needle");
+	};
+
+	BENCHMARK("Find a character in 1 MB with sl::String") {
+		return haystack.find('z');
+	};
+
+	BENCHMARK("Find a character in 1 MB with std::string_view") {
+		return haystackView.find('z');
+	};
+
+	BENCHMARK("Find the last character in 1 MB with sl::String") {
+		return haystack.rfind('z');
+	};
+
+	BENCHMARK("Find the last character in 1 MB with std::string_view") {
+		return haystackView.rfind('z');
+	};
+
+	const sl::String haystackCopy {haystack};
+	BENCHMARK("Compare 1 MB strings with sl::String") {
+		return haystack == haystackCopy;
+	};
+
+	BENCHMARK("Compare 1 MB strings with std::string_view") {
+		return haystackView == std::string_view{haystackCopy.getData(), haystackCopy.getSize()};
+	};
+
+	static constexpr std::size_t STRING_COUNT {1024 * 1024};
+	std::vector<sl::String> strings {};
+	strings.reserve(STRING_COUNT);
+	std::mt19937 rng {42};
+	for (std::size_t i {0}; i < STRING_COUNT; ++i) {
+		sl::String str {};
+		// mixes SSO and heap strings
+		const std::size_t size {4 + rng() % 28};
+		for (std::size_t j {0}; j < size; ++j)
+			str.pushBack(static_cast<char> ('a' + rng() % 26));
+		strings.push_back(std::move(str));
+	}
+
+	BENCHMARK("Copy and sort 1M strings") {
+		std::vector<sl::String> toSort {strings};
+		std::ranges::sort(toSort, {}, [](const sl::String &str) {return std::string_view{str.getData(), str.getSize()};});
+		return toSort.size();
+	};
+}
+
+
+TEST_CASE("sl::String : SSO capacity benchmarks", "[sl::String][.benchmark]") {
+	using String48 = sl::utils::BasicString<char, sl::memory::DefaultAllocator<char>, 48>;
+	static constexpr std::size_t STRING_COUNT {1024 * 1024};
+
+	for (const std::size_t size : {8uz, 24uz, 40uz}) {
+		const std::string source (size, 'a');
+
+		BENCHMARK("Build 1M strings of " + std::to_string(size) + " characters with sl::String") {
+			std::vector<sl::String> strings {};
+			strings.reserve(STRING_COUNT);
+			for (std::size_t i {0}; i < STRING_COUNT; ++i)
+				strings.emplace_back(source.data(), source.size());
+			return strings.size();
+		};
+
+		BENCHMARK("Build 1M strings of " + std::to_string(size) + " characters with a 48 characters SSO") {
+			std::vector<String48> strings {};
+			strings.reserve(STRING_COUNT);
+			for (std::size_t i {0}; i < STRING_COUNT; ++i)
+				strings.emplace_back(source.data(), source.size());
+			return strings.size();
+		};
+
+		BENCHMARK("Build 1M strings of " + std::to_string(size) + " characters with sl::InlineString<48>") {
+			std::vector<sl::InlineString<48>> strings {};
+			strings.reserve(STRING_COUNT);
+			for (std::size_t i {0}; i < STRING_COUNT; ++i)
+				strings.emplace_back(source.data(), source.size());
+			return strings.size();
+		};
+
+		BENCHMARK("Build 1M strings of " + std::to_string(size) + " characters with std::string") {
+			std::vector<std::string> strings {};
+			strings.reserve(STRING_COUNT);
+			for (std::size_t i {0}; i < STRING_COUNT; ++i)
+				strings.emplace_back(source.data(), source.size());
+			return strings.size();
+		};
+	}
+}
@@ -0,0 +1,119 @@
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <sl/utils/stringId.hpp>
+
+using namespace sl::utils::literals;
+
+
+TEST_CASE("sl::utils::StringId", "[sl::utils::StringId]") {
+	SECTION("Compile time identifiers") {
+		static_assert("sl_keydown"_sid == "sl_keydown"_sid);
+		static_assert("sl_keydown"_sid != "sl_keyup"_sid);
+		static_assert(sl::utils::StringId {} == ""_sid);
+		static_assert(sizeof(sl::utils::StringId) == sizeof(std::uint64_t));
+		REQUIRE(sl::utils::StringId("sl_keydown", 10) == "sl_keydown"_sid);
+	}
+
+	SECTION("Interning") {
+		const sl::utils::StringId id {sl::utils::StringIdTable::intern("sl_stringid_test")};
+		REQUIRE(id == "sl_stringid_test"_sid);
+		REQUIRE(std::strcmp(sl::utils::StringIdTable::find(id), "sl_stringid_test") == 0);
+
+		const std::size_t size {sl::utils::StringIdTable::getSize()};
+		REQUIRE(sl::utils::StringIdTable::intern(sl::String{"sl_stringid_test"}) == id);
+		REQUIRE(sl::utils::StringIdTable::getSize() == size);
+		// the interned string is stored once
+		REQUIRE(sl::utils::StringIdTable::find(id) == sl::utils::StringIdTable::find("sl_stringid_test"_sid));
+
+		REQUIRE(sl::utils::StringIdTable::find("sl_never_interned"_sid) == nullptr);
+	}
+
+	SECTION("Growth keeps the strings") {
+		std::vector<std::string> names {};
+		for (std::size_t i {0}; i < 10'000; ++i)
+			names.push_back("sl_growth_" + std::to_string(i));
+		std::vector<const char*> interned {};
+		for (const auto &name : names)
+			interned.push_back(sl::utils::StringIdTable::find(sl::utils::StringIdTable::intern(name.c_str())));
+
+		for (std::size_t i {0}; i < names.size(); ++i) {
+			const char *str {sl::utils::StringIdTable::find(sl::utils::StringId(names[i].data(), names[i].size()))};
+			REQUIRE(str == interned[i]);
+			REQUIRE(str == names[i]);
+		}
+	}
+
+	SECTION("Concurrent readers and writers") {
+		static constexpr std::size_t THREAD_COUNT {4};
+		static constexpr std::size_t NAME_COUNT {5'000};
+		std::atomic<bool> failed {false};
+		std::vector<std::thread> threads {};
+		for (std::size_t thread {0}; thread < THREAD_COUNT; ++thread) {
+			threads.emplace_back([thread, &failed] {
+				for (std::size_t i {0}; i < NAME_COUNT; ++i) {
+					// every thread interns the same names, in a different order
+					const std::string name {"sl_concurrent_" + std::to_string((i * (thread + 1)) % NAME_COUNT)};
+					const sl::utils::StringId id {sl::utils::StringIdTable::intern(name.c_str())};
+					const char *str {sl::utils::StringIdTable::find(id)};
+					if (str == nullptr || name != str)
+						failed = true;
+				}
+			});
+		}
+		for (auto &thread : threads)
+			thread.join();
+		REQUIRE(!failed);
+	}
+}
+
+
+TEST_CASE("sl::utils::StringId : benchmarks", "[sl::utils::StringId][.benchmark]") {
+	static constexpr std::size_t NAME_COUNT {1'000};
+	std::vector<std::string> names {};
+	std::vector<sl::String> strings {};
+	std::vector<sl::utils::StringId> ids {};
+	std::unordered_map<std::string, std::size_t> map {};
+	for (std::size_t i {0}; i < NAME_COUNT; ++i) {
+		names.push_back("sl_benchmark_category_" + std::to_string(i));
+		strings.push_back(sl::String{names.back().c_str()});
+		ids.push_back(sl::utils::StringIdTable::intern(names.back().c_str()));
+		map[names.back()] = i;
+	}
+
+	BENCHMARK("Intern 1k already interned names") {
+		std::size_t sum {0};
+		for (const auto &name : names)
+			sum += sl::utils::StringIdTable::intern(name.data(), name.size()).getValue();
+		return sum;
+	};
+
+	BENCHMARK("Look up 1k names in a std::unordered_map<std::string>") {
+		std::size_t sum {0};
+		for (const auto &name : names)
+			sum += map.find(name)->second;
+		return sum;
+	};
+
+	BENCHMARK("Compare 1k names as sl::String") {
+		std::size_t count {0};
+		for (const auto &string : strings)
+			count += string == strings.front() ? 1 : 0;
+		return count;
+	};
+
+	BENCHMARK("Compare 1k names as StringId") {
+		std::size_t count {0};
+		for (const auto id : ids)
+			count += id == ids.front() ? 1 : 0;
+		return count;
+	};
+}
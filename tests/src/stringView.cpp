@@ -0,0 +1,231 @@
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <random>
+#include <ranges>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <sl/utils/string.hpp>
+#include <sl/utils/stringView.hpp>
+#include <sl/utils/utils.hpp>
+
+using namespace sl::utils::literals;
+
+
+template <typename Range>
+static auto collect(Range &&range) -> std::vector<std::string_view> {
+	std::vector<std::string_view> pieces {};
+	for (sl::utils::StringView piece : range)
+		pieces.push_back(piece);
+	return pieces;
+}
+
+
+static constexpr auto countTokens(sl::utils::StringView str) noexcept -> std::size_t {
+	std::size_t count {0};
+	for ([[maybe_unused]] sl::utils::StringView token : str.tokenize(" \t"_sv))
+		++count;
+	return count;
+}
+
+
+TEST_CASE("sl::utils::StringView : basics", "[sl::utils::StringView]") {
+	static_assert(std::ranges::contiguous_range<sl::utils::StringView>);
+	static_assert(std::ranges::forward_range<decltype("a,b"_sv.split(','))>);
+	static_assert(std::ranges::forward_range<decltype("a b"_sv.tokenize(" \t"_sv))>);
+	static_assert(std::is_trivially_copyable_v<sl::utils::StringView>);
+	static_assert("1.2.3"_ver.major == 1 && "1.2.3"_ver.minor == 2 && "1.2.3"_ver.patch == 3);
+	static_assert("4.5"_ver.minor == 5 && "4.5"_ver.patch == 0);
+	static_assert(countTokens("  hello \t world  ") == 2);
+
+	SECTION("Construction and conversions") {
+		const sl::utils::StringView empty {};
+		REQUIRE(empty.isEmpty());
+		REQUIRE(empty.getSize() == 0);
+
+		const char *literal {"Hello World !"};
+		const sl::utils::StringView fromPointer {literal};
+		REQUIRE(fromPointer.getData() == literal);
+		REQUIRE(fromPointer.getSize() == 13);
+
+		const sl::String string {"Hello World ! This string doesn't fit in SSO"};
+		const sl::utils::StringView fromString {string};
+		REQUIRE(fromString.getData() == string.getData());
+		REQUIRE(fromString.getSize() == string.getSize());
+		REQUIRE(string.getView() == fromString);
+		REQUIRE(string.getView(6, 5) == "World");
+
+		const std::string_view standard {fromString};
+		REQUIRE(standard == "Hello World ! This string doesn't fit in SSO");
+		REQUIRE(sl::utils::StringView{standard} == fromString);
+
+		const sl::String copy {fromPointer};
+		REQUIRE(copy == "Hello World !");
+		REQUIRE(copy.getData() != literal);
+	}
+
+	SECTION("Comparison and search") {
+		const sl::utils::StringView str {"Hello World !"};
+		REQUIRE(str == "Hello World !");
+		REQUIRE(str != "Hello World");
+		REQUIRE(str < "Hello World ?"_sv);
+		REQUIRE(str > "Hello"_sv);
+		REQUIRE("abc"_sv < "abd"_sv);
+
+		REQUIRE(str.find('o') == 4);
+		REQUIRE(str.find('o', 5) == 7);
+		REQUIRE(str.find('z') == std::nullopt);
+		REQUIRE(str.find("World") == 6);
+		REQUIRE(str.find("World", 7) == std::nullopt);
+		REQUIRE(str.rfind('o') == 7);
+		REQUIRE(str.rfind("l") == 9);
+		REQUIRE(str.contains('!'));
+		REQUIRE(!str.contains("world"));
+		REQUIRE(str.startsWith("Hello"));
+		REQUIRE(!str.startsWith("Hello World ! "));
+		REQUIRE(str.endsWith("d !"));
+	}
+
+	SECTION("Slicing") {
+		sl::utils::StringView str {"Hello World !"};
+		REQUIRE(str.subView(6) == "World !");
+		REQUIRE(str.subView(6, 5) == "World");
+		REQUIRE(str.subView(6, 100) == "World !");
+		REQUIRE(str.subView(100).isEmpty());
+
+		str.popFront(6);
+		REQUIRE(str == "World !");
+		str.popBack(2);
+		REQUIRE(str == "World");
+		str.popBack(100);
+		REQUIRE(str.isEmpty());
+	}
+
+	SECTION("Number parsing") {
+		REQUIRE(sl::utils::stringToNumber<std::int32_t> ("-1234"_sv) == -1234);
+		REQUIRE(sl::utils::stringToNumber<std::int32_t> ("12a"_sv) == std::nullopt);
+		REQUIRE(sl::utils::stringToNumber<double> ("version=2.5"_sv.subView(8)) == 2.5);
+	}
+}
+
+
+TEST_CASE("sl::utils::StringView : split and tokenize", "[sl::utils::StringView]") {
+	SECTION("Split on a character keeps the empty pieces") {
+		REQUIRE(collect("a,b,,c"_sv.split(',')) == std::vector<std::string_view> {"a", "b", "", "c"});
+		REQUIRE(collect(",a,"_sv.split(',')) == std::vector<std::string_view> {"", "a", ""});
+		REQUIRE(collect("abc"_sv.split(',')) == std::vector<std::string_view> {"abc"});
+		REQUIRE(collect(""_sv.split(',')) == std::vector<std::string_view> {""});
+	}
+
+	SECTION("Split on a string") {
+		REQUIRE(collect("a::b:c::"_sv.split("::")) == std::vector<std::string_view> {"a", "b:c", ""});
+		REQUIRE(collect("abc"_sv.split(""_sv)) == std::vector<std::string_view> {"abc"});
+	}
+
+	SECTION("Tokenize skips the empty pieces") {
+		REQUIRE(collect("  a  b c "_sv.tokenize(' ')) == std::vector<std::string_view> {"a", "b", "c"});
+		REQUIRE(collect("a \t b\t\tc"_sv.tokenize(" \t"_sv)) == std::vector<std::string_view> {"a", "b", "c"});
+		REQUIRE(collect("   "_sv.tokenize(' ')).empty());
+		REQUIRE(collect(""_sv.tokenize(' ')).empty());
+	}
+
+	SECTION("Pieces point into the source") {
+		const sl::String source {"assets/textures/player.png"};
+		std::vector<const char*> starts {};
+		for (sl::utils::StringView piece : sl::utils::StringView{source}.split('/'))
+			starts.push_back(piece.getData());
+		REQUIRE(starts == std::vector<const char*> {source.getData(), source.getData() + 7, source.getData() + 16});
+	}
+
+	SECTION("Works with the standard ranges") {
+		auto sizes {"one two three"_sv.tokenize(' ') | std::views::transform([](sl::utils::StringView token) {return token.getSize();})};
+		std::vector<std::size_t> collected {};
+		std::ranges::copy(sizes, std::back_inserter(collected));
+		REQUIRE(collected == std::vector<std::size_t> {3, 3, 5});
+		REQUIRE(std::ranges::distance("a.b.c.d"_sv.split('.')) == 4);
+	}
+}
+
+
+TEST_CASE("sl::utils::StringView : BasicString overloads", "[sl::utils::StringView]") {
+	sl::String str {"Hello World !"};
+	const sl::utils::StringView world {"World ! And some text to leave the view unterminated", 5};
+
+	REQUIRE(str.find(world) == 6);
+	REQUIRE(str.rfind(world) == 6);
+	REQUIRE(str.contains(world));
+	REQUIRE(str.startsWith("Hello World ! ..."_sv.subView(0, 5)));
+	REQUIRE(str.endsWith(" !"_sv));
+	REQUIRE(str.compare("Hello"_sv) == std::strong_ordering::greater);
+	REQUIRE(str == "Hello World !"_sv);
+	REQUIRE("Hello World !"_sv == str);
+
+	str += " "_sv;
+	str.pushBack(world);
+	REQUIRE(str == "Hello World ! World");
+	str.pushFront(world);
+	REQUIRE(str == "WorldHello World ! World");
+	str.insert(5, " - "_sv);
+	REQUIRE(str == "World - Hello World ! World");
+
+	const sl::String concatenated {str + " : "_sv + world};
+	REQUIRE(concatenated == "World - Hello World ! World : World");
+}
+
+
+TEST_CASE("sl::utils::StringView : benchmarks", "[sl::utils::StringView][.benchmark]") {
+	std::mt19937_64 random {42};
+	sl::String csv {};
+	for (std::size_t line {0}; line < 20'000; ++line) {
+		for (std::size_t column {0}; column < 8; ++column) {
+			if (column != 0)
+				csv.pushBack(',');
+			const std::size_t size {random() % 24};
+			for (std::size_t i {0}; i < size; ++i)
+				csv.pushBack(static_cast<char> ('a' + random() % 26));
+		}
+		csv.pushBack('\n');
+	}
+
+	BENCHMARK("Split 160k fields with views") {
+		std::size_t sum {0};
+		for (sl::utils::StringView line : sl::utils::StringView{csv}.split('\n')) {
+			for (sl::utils::StringView field : line.split(','))
+				sum += field.getSize();
+		}
+		return sum;
+	};
+
+	BENCHMARK("Split 160k fields by copying into sl::String") {
+		std::size_t sum {0};
+		std::size_t lineStart {0};
+		while (lineStart < csv.getSize()) {
+			const std::size_t lineEnd {csv.find('\n', lineStart).value_or(csv.getSize())};
+			std::size_t fieldStart {lineStart};
+			while (true) {
+				const std::size_t fieldEnd {std::min(csv.find(',', fieldStart).value_or(lineEnd), lineEnd)};
+				const sl::String field {csv.getData() + fieldStart, fieldEnd - fieldStart};
+				sum += field.getSize();
+				if (fieldEnd == lineEnd)
+					break;
+				fieldStart = fieldEnd + 1;
+			}
+			lineStart = lineEnd + 1;
+		}
+		return sum;
+	};
+
+	BENCHMARK("Split 160k fields with std::views::split") {
+		std::size_t sum {0};
+		for (auto line : std::string_view{csv} | std::views::split('\n')) {
+			for (auto field : std::string_view{line} | std::views::split(','))
+				sum += std::string_view{field}.size();
+		}
+		return sum;
+	};
+}
@@ -0,0 +1,145 @@
+#include <sstream>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <sl/memory/heapAllocator.hpp>
+#include <sl/memory/poolAllocator.hpp>
+#include <sl/memory/stackAllocator.hpp>
+#include <sl/memory/trackingAllocator.hpp>
+
+
+using namespace sl::utils::literals;
+
+
+TEST_CASE("sl::memory::TrackingAllocator", "[sl::memory::TrackingAllocator]") {
+	sl::memory::MemoryTracker tracker {sl::memory::MemoryTrackerCreateInfos{.callstackSamplingPeriod = 1, .reportOnDestruction = false}};
+
+	SECTION("Leaks and tags") {
+		sl::memory::PoolAllocator<int> poolAllocator {16};
+		sl::memory::TrackingAllocator<sl::memory::PoolAllocator<int>> meshes {poolAllocator, tracker, "meshes"};
+		sl::memory::TrackingAllocator<sl::memory::PoolAllocator<int>> textures {poolAllocator, tracker, "textures"};
+
+		int *first {meshes.allocate(1)};
+		int *second {meshes.allocate(1)};
+		tracker.endFrame();
+		int *third {textures.allocate(1)};
+		meshes.deallocate(first, 1);
+
+		auto allocations {tracker.getLiveAllocations()};
+		REQUIRE(allocations.size() == 2);
+		auto leak {std::ranges::find(allocations, static_cast<const void*> (third), &sl::memory::TrackedAllocation::address)};
+		REQUIRE(leak != allocations.end());
+		REQUIRE(leak->size == sizeof(int));
+		REQUIRE(leak->alignment == alignof(int));
+		REQUIRE(leak->tag == "textures");
+		REQUIRE(leak->frameIndex == 1);
+		REQUIRE(!leak->callstack.empty());
+
+		auto usages {tracker.getTagUsages()};
+		REQUIRE(usages.size() == 2);
+		for (const auto &usage : usages) {
+			REQUIRE(usage.liveCount == 1);
+			REQUIRE(usage.liveSize == sizeof(int));
+		}
+		REQUIRE(std::ranges::find(usages, "meshes", &sl::memory::TagUsage::tag)->peakSize == 2 * sizeof(int));
+
+		meshes.deallocate(second, 1);
+		textures.deallocate(third, 1);
+		REQUIRE(tracker.getLiveAllocations().empty());
+	}
+
+	SECTION("Double frees don't reach the allocator") {
+		sl::memory::PoolAllocator<int> poolAllocator {16};
+		sl::memory::TrackingAllocator<sl::memory::PoolAllocator<int>> allocator {poolAllocator, tracker};
+
+		int *ptr {allocator.allocate(1)};
+		allocator.deallocate(ptr, 1);
+		allocator.deallocate(ptr, 1);
+		int unknown {};
+		allocator.deallocate(&unknown, 1);
+
+		auto invalidDeallocations {tracker.getInvalidDeallocations()};
+		REQUIRE(invalidDeallocations.size() == 2);
+		REQUIRE(invalidDeallocations[0].address == ptr);
+		REQUIRE(invalidDeallocations[0].isDoubleFree);
+		REQUIRE(invalidDeallocations[1].address == &unknown);
+		REQUIRE(!invalidDeallocations[1].isDoubleFree);
+
+		// the pool's free list wasn't corrupted by the double free
+		int *first {allocator.allocate(1)};
+		int *second {allocator.allocate(1)};
+		REQUIRE(first != second);
+		allocator.deallocate(first, 1);
+		allocator.deallocate(second, 1);
+	}
+
+	SECTION("Only the recent frees are remembered") {
+		sl::memory::PoolAllocator<int> poolAllocator {5000};
+		sl::memory::TrackingAllocator<sl::memory::PoolAllocator<int>> allocator {poolAllocator, tracker};
+
+		std::vector<int*> pointers {};
+		for (std::size_t i {0}; i < 5000; ++i)
+			pointers.push_back(allocator.allocate(1));
+		for (int *ptr : pointers)
+			allocator.deallocate(ptr, 1);
+
+		allocator.deallocate(pointers.back(), 1);
+		allocator.deallocate(pointers.front(), 1);
+		auto invalidDeallocations {tracker.getInvalidDeallocations()};
+		REQUIRE(invalidDeallocations.size() == 2);
+		REQUIRE(invalidDeallocations[0].isDoubleFree);
+		// too old to be told from an unknown pointer
+		REQUIRE(!invalidDeallocations[1].isDoubleFree);
+	}
+
+	SECTION("Heap handles stay tracked through defragmentation") {
+		sl::memory::HeapAllocator heapAllocator {1_MiB, 1, 32_B};
+		sl::memory::TrackingAllocator<sl::memory::HeapAllocatorView<int>> allocator {heapAllocator, tracker, "heap"};
+
+		auto first {allocator.allocate(4)};
+		auto second {allocator.allocate(4)};
+		allocator.deallocate(first, 4);
+		heapAllocator.defragment(sl::memory::HeapDefragmentationBudget{});
+
+		REQUIRE(tracker.getLiveAllocations().size() == 1);
+		allocator.deallocate(second, 4);
+		REQUIRE(tracker.getLiveAllocations().empty());
+		REQUIRE(tracker.getInvalidDeallocations().empty());
+	}
+
+	SECTION("Stack allocations and bulk deallocation") {
+		sl::memory::StackAllocator stackAllocator {1_kiB};
+		sl::memory::TrackingAllocator<sl::memory::StackAllocatorView<char>> allocator {stackAllocator, tracker, "frame"};
+		REQUIRE(allocator.allocate(16) != nullptr);
+		REQUIRE(allocator.allocate(16) != nullptr);
+		REQUIRE(tracker.getLiveAllocations().size() == 2);
+
+		stackAllocator.clear();
+		tracker.onBulkDeallocation("frame");
+		REQUIRE(tracker.getLiveAllocations().empty());
+		REQUIRE(tracker.getTagUsages()[0].liveSize == 0_B);
+	}
+
+	SECTION("Memory resource") {
+		sl::memory::HeapAllocator heapAllocator {1_MiB, 1, 32_B};
+		sl::memory::HeapMemoryResource heapMemoryResource {heapAllocator};
+		sl::memory::TrackingMemoryResource resource {heapMemoryResource, tracker, "pmr"};
+
+		std::pmr::vector<int> values {&resource};
+		for (int i {0}; i < 100; ++i)
+			values.push_back(i);
+		REQUIRE(tracker.getLiveAllocations().size() == 1);
+
+		void *ptr {resource.allocate(64, 16)};
+		resource.deallocate(ptr, 64, 16);
+		resource.deallocate(ptr, 64, 16);
+		REQUIRE(tracker.getInvalidDeallocations().size() == 1);
+		REQUIRE(tracker.getInvalidDeallocations()[0].isDoubleFree);
+
+		std::ostringstream stream {};
+		tracker.report(stream);
+		REQUIRE(stream.str().find("double free") != std::string::npos);
+		REQUIRE(stream.str().find("pmr") != std::string::npos);
+	}
+}